@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-SnippetCopyrightText: Copyright 2016 Google Inc.
+
+/**
+ * @file abseil.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from Abseil's civil time [1]
+ * (absl/time/internal/cctz/include/cctz/civil_time_detail.h).
+ *
+ * to_date adds days to 1 January 1970, as absl::CivilDay's operator + does
+ * (n_day), and to_rata_die subtracts it, as operator - does (ymd_ord).
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://abseil.io
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_ABSEIL_HPP
+#define EAF_ALGORITHMS_ABSEIL_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct abseil {
+
+  // Original epoch: 1 January 1970.
+
+  static inline
+  date32_t to_date(int32_t rata_die) {
+    fields const f = n_day(1970, 1, 1, rata_die);
+    return { int32_t(f.y), uint32_t(f.m), uint32_t(f.d) };
+  }
+
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+    return int32_t(ymd_ord(year, month, day));
+  }
+
+private:
+
+  // https://github.com/abseil/abseil-cpp/blob/master/absl/time/internal/cctz/include/cctz/civil_time_detail.h
+  using year_t  = std::int_fast64_t;
+  using diff_t  = std::int_fast64_t;
+  using month_t = std::int_fast8_t;
+  using day_t   = std::int_fast8_t;
+
+  struct fields {
+    year_t  y;
+    month_t m;
+    day_t   d;
+  };
+
+  static constexpr
+  bool is_leap_year(year_t y) noexcept {
+    return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+  }
+  static constexpr
+  int year_index(year_t y, month_t m) noexcept {
+    const int yi = static_cast<int>((y + (m > 2)) % 400);
+    return yi < 0 ? yi + 400 : yi;
+  }
+  static constexpr
+  int days_per_century(int yi) noexcept {
+    return 36524 + (yi == 0 || yi > 300);
+  }
+  static constexpr
+  int days_per_4years(int yi) noexcept {
+    return 1460 + (yi == 0 || yi > 300 || (yi - 1) % 100 < 96);
+  }
+  static constexpr
+  int days_per_year(year_t y, month_t m) noexcept {
+    return is_leap_year(y + (m > 2)) ? 366 : 365;
+  }
+  static constexpr
+  int days_per_month(year_t y, month_t m) noexcept {
+    constexpr int k_days_per_month[1 + 12] = {
+        -1, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31  // non leap year
+    };
+    return k_days_per_month[m] + (m == 2 && is_leap_year(y));
+  }
+
+  static constexpr
+  fields n_day(year_t y, month_t m, diff_t d, diff_t cd) noexcept {
+    year_t ey = y % 400;
+    const year_t oey = ey;
+    ey += (cd / 146097) * 400;
+    cd %= 146097;
+    if (cd < 0) {
+      ey -= 400;
+      cd += 146097;
+    }
+    ey += (d / 146097) * 400;
+    d = d % 146097 + cd;
+    if (d > 0) {
+      if (d > 146097) {
+        ey += 400;
+        d -= 146097;
+      }
+    } else {
+      if (d > -365) {
+        // We often hit the previous year when stepping a civil time
+        // backwards, so special case it to avoid counting up by 100/4/1-year
+        // chunks.
+        ey -= 1;
+        d += days_per_year(ey, m);
+      } else {
+        ey -= 400;
+        d += 146097;
+      }
+    }
+    if (d > 365) {
+      int yi = year_index(ey, m);  // Index into Gregorian 400 year cycle.
+      for (;;) {
+        int n = days_per_century(yi);
+        if (d <= n) break;
+        d -= n;
+        ey += 100;
+        yi += 100;
+        if (yi >= 400) yi -= 400;
+      }
+      for (;;) {
+        int n = days_per_4years(yi);
+        if (d <= n) break;
+        d -= n;
+        ey += 4;
+        yi += 4;
+        if (yi >= 400) yi -= 400;
+      }
+      for (;;) {
+        int n = days_per_year(ey, m);
+        if (d <= n) break;
+        d -= n;
+        ++ey;
+      }
+    }
+    if (d > 28) {
+      for (;;) {
+        int n = days_per_month(ey, m);
+        if (d <= n) break;
+        d -= n;
+        if (++m > 12) {
+          ++ey;
+          m = 1;
+        }
+      }
+    }
+    return fields{y + (ey - oey), m, static_cast<day_t>(d)};
+  }
+
+  static constexpr
+  diff_t ymd_ord(year_t y, month_t m, day_t d) noexcept {
+    const diff_t eyear = (m <= 2) ? y - 1 : y;
+    const diff_t era = (eyear >= 0 ? eyear : eyear - 399) / 400;
+    const diff_t yoe = eyear - era * 400;
+    const diff_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const diff_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+  }
+
+}; // struct abseil
+
+#endif // EAF_ALGORITHMS_ABSEIL_HPP
@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file benjoffe_fast16.hpp
+ *
+ * @brief to_date and to_rata_die on int16_t day numbers, i.e., from
+ * 14 April 1880 to 18 September 2059 around the Unix epoch, in 16-bit
+ * arithmetic only.
+ *
+ * Every step is an add, shift, compare/select, 16-bit product or high half
+ * of a 16 x 16-bit product, so that the batch forms run on 16-bit lanes:
+ * 16 per AVX2 and 32 per AVX-512BW register, twice as many as widening to
+ * int32_t first. tests/fast16_tests.cpp checks the constants on all 65,536
+ * inputs. Unvectorised, the 32-bit carries make it slower than
+ * benjoffe_fast32.
+ *
+ * In range, 1900 is the only year divisible by 4 that is not a leap year.
+ * Days from 1 March 1900 count one more, as if 29 February 1900 existed,
+ * and the Julian calendar's 4-year cycles do the rest.
+ *
+ *     [1] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_BENJOFFE_FAST16_H
+#define EAF_ALGORITHMS_BENJOFFE_FAST16_H
+
+#include "eaf/date.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+struct benjoffe_fast16 {
+
+  // Day numbers count from 1 January 1970.
+
+  int32_t  static constexpr rata_die_min = INT16_MIN;
+  int32_t  static constexpr rata_die_max = INT16_MAX;
+  date32_t static constexpr date_min     = { 1880, 4, 14 };
+  date32_t static constexpr date_max     = { 2059, 9, 18 };
+
+  static inline
+  date32_t to_date(int16_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return { int32_t(p.year) + 1880, p.month, p.day };
+  }
+
+  static inline
+  int16_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+    return rata_die(uint16_t(year - 1880), uint16_t(month), uint16_t(day));
+  }
+
+  // Batch forms of the above on columns of narrow types. Built with
+  // AVX-512BW or AVX2, 32 or 16 rows at a time go through the same steps on
+  // 16-bit lanes (_mm256_mulhi_epu16 for mulhi), see to_date_lanes and
+  // rata_die_lanes. The remaining rows, or all of them without AVX2, go
+  // through the scalar forms.
+
+  static inline
+  void to_date(int16_t const* dayNumbers, int16_t* years, uint8_t* months,
+    uint8_t* days, size_t count) {
+    size_t i = 0;
+#if defined(__AVX512BW__)
+    for (; i + avx512bw_t::lanes <= count; i += avx512bw_t::lanes)
+      to_date_lanes<avx512bw_t>(dayNumbers + i, years + i, months + i,
+        days + i);
+#endif
+#if defined(__AVX2__)
+    for (; i + avx2_t::lanes <= count; i += avx2_t::lanes)
+      to_date_lanes<avx2_t>(dayNumbers + i, years + i, months + i, days + i);
+#endif
+    for (; i < count; ++i) {
+      parts_t const p = parts(dayNumbers[i]);
+      years[i]  = int16_t(p.year + 1880);
+      months[i] = uint8_t(p.month);
+      days[i]   = uint8_t(p.day);
+    }
+  }
+
+  static inline
+  void to_rata_die(int16_t const* years, uint8_t const* months,
+    uint8_t const* days, int16_t* dayNumbers, size_t count) {
+    size_t i = 0;
+#if defined(__AVX512BW__)
+    for (; i + avx512bw_t::lanes <= count; i += avx512bw_t::lanes)
+      rata_die_lanes<avx512bw_t>(years + i, months + i, days + i,
+        dayNumbers + i);
+#endif
+#if defined(__AVX2__)
+    for (; i + avx2_t::lanes <= count; i += avx2_t::lanes)
+      rata_die_lanes<avx2_t>(years + i, months + i, days + i,
+        dayNumbers + i);
+#endif
+    for (; i < count; ++i)
+      dayNumbers[i] = rata_die(uint16_t(years[i] - 1880), months[i],
+        days[i]);
+  }
+
+private:
+
+  // Days from 14 April 1880 to 1 March 1900:
+  static uint16_t constexpr U_1900 = 7260;
+
+  // 2^24 * 4 / 1461 = A + A_FRAC / 2^16 (rounded):
+  static uint16_t constexpr A      = 45933;
+  static uint16_t constexpr A_FRAC = 33688;
+
+  // Offsets of 14 April 1880 (44 days after 1 March) before and after
+  // 1 March 1900, B = B_HI * 2^16 + B_LO:
+  static uint16_t constexpr B_HI_0 = 31;
+  static uint16_t constexpr B_LO_0 = 0x8000;
+  static uint16_t constexpr B_HI_1 = 32;
+  static uint16_t constexpr B_LO_1 = 0x2000;
+
+  struct parts_t {
+    uint16_t year;  // since 1880
+    uint16_t month;
+    uint16_t day;
+  };
+
+  static inline
+  uint16_t mulhi(uint16_t const a, uint16_t const b) {
+    return uint16_t(uint32_t(a) * b >> 16);
+  }
+
+  static inline
+  parts_t parts(int16_t dayNumber) {
+
+    // 1. Days since 14 April 1880, and whether the day is after the missing
+    // 29 February 1900:
+    uint16_t const u = uint16_t(dayNumber) ^ 0x8000;
+    bool const after = u >= U_1900;
+
+    // 2. EAF numerator P = (4 * J + 3) * 2^24 / 1461 in 32 bits, as the
+    // high and low halves, where J is the Julian day count from 1 March
+    // 1880. The top 8 bits are years since 1880, the next 16 the year-part:
+    uint16_t lo = uint16_t(u * A);
+    uint16_t hi = mulhi(u, A);
+    uint16_t const fra = mulhi(u, A_FRAC);
+    lo = uint16_t(lo + fra);
+    hi = uint16_t(hi + (lo < fra));
+    uint16_t const b_lo = after ? B_LO_1 : B_LO_0;
+    uint16_t const b_hi = after ? B_HI_1 : B_HI_0;
+    lo = uint16_t(lo + b_lo);
+    hi = uint16_t(hi + b_hi + (lo < b_lo));
+
+    uint16_t const yrs = hi >> 8;
+    uint16_t const ypt = uint16_t(hi << 8 | lo >> 8);
+
+    // 3. Day-of-year from 1 March (ypt * 365.25 / 2^16), and month (March
+    // = 3, February = 14) as (5 * doy + 461) / 153 of Neri-Schneider [1]:
+    uint16_t const doy = mulhi(ypt, 46752) >> 7;
+    uint16_t const M   = mulhi(uint16_t(4 * doy + 369), 1071) >> 1;
+    uint16_t const D   = uint16_t(doy - ((979 * M - 2919) >> 5));
+
+    // 4. Back to January-based years:
+    bool const bump = M > 12;
+    uint16_t const month = bump ? M - 12 : M;
+
+    return { uint16_t(yrs + bump), month, uint16_t(D + 1) };
+  }
+
+  static inline
+  int16_t rata_die(uint16_t year, uint16_t month, uint16_t day) {
+
+    // March-based year since 1880 and month (March = 3, February = 14):
+    bool const bump = month <= 2;
+    uint16_t const yrs = uint16_t(year - bump);
+    uint16_t const M = bump ? month + 12 : month;
+
+    // Julian day count from 1 March 1880, less 29 February 1900 and the
+    // 44 days to 14 April 1880:
+    uint16_t const u = uint16_t(365 * yrs + yrs / 4 +
+      ((979 * M - 2919) >> 5) + day - 45 - (yrs >= 20));
+
+    return int16_t(u ^ 0x8000);
+  }
+
+#if defined(__AVX2__)
+
+  // The operations of parts and rata_die on registers of 16-bit lanes, for
+  // to_date_lanes and rata_die_lanes. Masks are the results of comparisons
+  // and add_if(x, m, c) adds c to the lanes of x where m is set.
+
+  struct avx2_t {
+
+    using reg_t  = __m256i;
+    using mask_t = __m256i;
+
+    static size_t constexpr lanes = 16;
+
+    static reg_t set1(uint16_t c) { return _mm256_set1_epi16(int16_t(c)); }
+
+    static reg_t add(reg_t a, reg_t b) { return _mm256_add_epi16(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm256_sub_epi16(a, b); }
+    static reg_t mul(reg_t a, reg_t b) { return _mm256_mullo_epi16(a, b); }
+    static reg_t mulhi(reg_t a, reg_t b) { return _mm256_mulhi_epu16(a, b); }
+    static reg_t or_(reg_t a, reg_t b) { return _mm256_or_si256(a, b); }
+    static reg_t xor_(reg_t a, reg_t b) { return _mm256_xor_si256(a, b); }
+
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm256_srli_epi16(a, n); }
+    template <int n>
+    static reg_t slli(reg_t a) { return _mm256_slli_epi16(a, n); }
+
+    // Signed a > b, and unsigned a < b (as signed, with the top bits
+    // flipped):
+    static mask_t gt(reg_t a, reg_t b) { return _mm256_cmpgt_epi16(a, b); }
+    static mask_t ltu(reg_t a, reg_t b) {
+      return gt(xor_(b, set1(0x8000)), xor_(a, set1(0x8000)));
+    }
+
+    static reg_t add_if(reg_t x, mask_t m, reg_t c) {
+      return add(x, _mm256_and_si256(m, c));
+    }
+
+    static reg_t load(int16_t const* p) {
+      return _mm256_loadu_si256((__m256i const*) p);
+    }
+    static reg_t load(uint8_t const* p) {
+      return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i const*) p));
+    }
+
+    static void store(int16_t* p, reg_t a) {
+      _mm256_storeu_si256((__m256i*) p, a);
+    }
+    // The low bytes of the lanes, which are less than 256:
+    static void store(uint8_t* p, reg_t a) {
+      _mm_storeu_si128((__m128i*) p, _mm256_castsi256_si128(
+        _mm256_permute4x64_epi64(_mm256_packus_epi16(a, a), 0x08)));
+    }
+  };
+
+#endif // defined(__AVX2__)
+
+#if defined(__AVX512BW__)
+
+  struct avx512bw_t {
+
+    using reg_t  = __m512i;
+    using mask_t = __mmask32;
+
+    static size_t constexpr lanes = 32;
+
+    static reg_t set1(uint16_t c) { return _mm512_set1_epi16(int16_t(c)); }
+
+    static reg_t add(reg_t a, reg_t b) { return _mm512_add_epi16(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm512_sub_epi16(a, b); }
+    static reg_t mul(reg_t a, reg_t b) { return _mm512_mullo_epi16(a, b); }
+    static reg_t mulhi(reg_t a, reg_t b) { return _mm512_mulhi_epu16(a, b); }
+    static reg_t or_(reg_t a, reg_t b) { return _mm512_or_si512(a, b); }
+    static reg_t xor_(reg_t a, reg_t b) { return _mm512_xor_si512(a, b); }
+
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm512_srli_epi16(a, n); }
+    template <int n>
+    static reg_t slli(reg_t a) { return _mm512_slli_epi16(a, n); }
+
+    static mask_t gt(reg_t a, reg_t b) {
+      return _mm512_cmpgt_epi16_mask(a, b);
+    }
+    static mask_t ltu(reg_t a, reg_t b) {
+      return _mm512_cmplt_epu16_mask(a, b);
+    }
+
+    static reg_t add_if(reg_t x, mask_t m, reg_t c) {
+      return _mm512_mask_add_epi16(x, m, x, c);
+    }
+
+    static reg_t load(int16_t const* p) { return _mm512_loadu_si512(p); }
+    static reg_t load(uint8_t const* p) {
+      return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i const*) p));
+    }
+
+    static void store(int16_t* p, reg_t a) { _mm512_storeu_si512(p, a); }
+    static void store(uint8_t* p, reg_t a) {
+      _mm512_mask_cvtepi16_storeu_epi8(p, __mmask32(-1), a);
+    }
+  };
+
+#endif // defined(__AVX512BW__)
+
+#if defined(__AVX2__)
+
+  // The batch to_date of V::lanes rows, as parts.
+  template <typename V>
+  static inline
+  void to_date_lanes(int16_t const* dayNumbers, int16_t* years,
+    uint8_t* months, uint8_t* days) {
+
+    using reg_t  = typename V::reg_t;
+    using mask_t = typename V::mask_t;
+
+    // 1. As u >= U_1900 on the signed day numbers:
+    reg_t const x = V::load(dayNumbers);
+    reg_t const u = V::xor_(x, V::set1(0x8000));
+    mask_t const after = V::gt(x, V::set1(U_1900 - 0x8000 - 1));
+
+    // 2. The carries of the low halves are unsigned lo < addend, and add
+    // 1 to the high halves:
+    reg_t const one = V::set1(1);
+    reg_t lo = V::mul(u, V::set1(A));
+    reg_t hi = V::mulhi(u, V::set1(A));
+    reg_t const fra = V::mulhi(u, V::set1(A_FRAC));
+    lo = V::add(lo, fra);
+    hi = V::add_if(hi, V::ltu(lo, fra), one);
+    reg_t const b_lo = V::add_if(V::set1(B_LO_0), after,
+      V::set1(B_LO_1 - B_LO_0));
+    reg_t const b_hi = V::add_if(V::set1(B_HI_0), after,
+      V::set1(B_HI_1 - B_HI_0));
+    lo = V::add(lo, b_lo);
+    hi = V::add_if(V::add(hi, b_hi), V::ltu(lo, b_lo), one);
+
+    reg_t const yrs = V::template srli<8>(hi);
+    reg_t const ypt = V::or_(V::template slli<8>(hi),
+      V::template srli<8>(lo));
+
+    // 3.
+    reg_t const doy = V::template srli<7>(V::mulhi(ypt, V::set1(46752)));
+    reg_t const M   = V::template srli<1>(V::mulhi(V::add(
+      V::template slli<2>(doy), V::set1(369)), V::set1(1071)));
+    reg_t const D   = V::sub(doy, V::template srli<5>(V::sub(
+      V::mul(M, V::set1(979)), V::set1(2919))));
+
+    // 4.
+    mask_t const bump = V::gt(M, V::set1(12));
+    V::store(years, V::add(V::add_if(yrs, bump, one), V::set1(1880)));
+    V::store(months, V::add_if(M, bump, V::set1(uint16_t(-12))));
+    V::store(days, V::add(D, one));
+  }
+
+  // The batch to_rata_die of V::lanes rows, as rata_die.
+  template <typename V>
+  static inline
+  void rata_die_lanes(int16_t const* years, uint8_t const* months,
+    uint8_t const* days, int16_t* dayNumbers) {
+
+    using reg_t  = typename V::reg_t;
+    using mask_t = typename V::mask_t;
+
+    reg_t const minus_one = V::set1(uint16_t(-1));
+    reg_t const month = V::load(months);
+
+    mask_t const bump = V::gt(V::set1(3), month);
+    reg_t const yrs = V::add_if(V::sub(V::load(years), V::set1(1880)), bump,
+      minus_one);
+    reg_t const M = V::add_if(month, bump, V::set1(12));
+
+    reg_t u = V::add(V::mul(yrs, V::set1(365)), V::template srli<2>(yrs));
+    u = V::add(u, V::template srli<5>(V::sub(V::mul(M, V::set1(979)),
+      V::set1(2919))));
+    u = V::sub(V::add(u, V::load(days)), V::set1(45));
+    u = V::add_if(u, V::gt(yrs, V::set1(19)), minus_one);
+
+    V::store(dayNumbers, V::xor_(u, V::set1(0x8000)));
+  }
+
+#endif // defined(__AVX2__)
+
+}; // struct benjoffe_fast16
+
+#endif // EAF_ALGORITHMS_BENJOFFE_FAST16_H
@@ -28,16 +28,17 @@
 #define EAF_ALGORITHMS_BENJOFFE_FAST32_H
 
 #include "eaf/date.hpp"
+#include "eaf/bounds.hpp"
+#include "eaf/variant.hpp"
+#include "util/date_trunc.hpp"
+#include "util/epoch.hpp"
 
 #include <stdint.h>
 
-#if defined(__aarch64__) || defined(_M_ARM64)
-#define IS_ARM 1
-#else
-#define IS_ARM 0
-#endif
-
-struct benjoffe_fast32 {
+template <int32_t EPOCH = epoch::unix_time,
+  typename BOUNDS = eaf::bounds::unchecked,
+  typename VARIANT = eaf::variant::native>
+struct benjoffe_fast32_t {
 
   // Very fast 32-bit algorithm.
   // Not quite as fast as the 64-bit variant, but close.
@@ -47,21 +48,135 @@ struct benjoffe_fast32 {
   //
   // Backwards-counting technique explained in:
   // [3] https://www.benjoffe.com/fast-date-64
+  //
+  // Day numbers count from EPOCH, see benjoffe_fast64.
 
   // Sufficient eras to cover C++ Chrono Year
   // i.e. support at least -2^16 years:
   static uint32_t constexpr ERAS = 82;
   // Rata Die shift:
-  static uint32_t constexpr D_SHIFT = 146097 * ERAS - 719162 - 307;
+  static uint32_t constexpr D_SHIFT = 146097 * ERAS - 719162 - 307 - EPOCH;
   // Year shift:
   static uint32_t constexpr Y_SHIFT = 400 * ERAS - 1;
 
+  // Largest reverse day count for which C1 and C2 are exact (found by
+  // exhaustive search.) The input range follows from 0 <= rev <= REV_MAX.
+  static uint32_t constexpr REV_MAX = 1073719813;
+
+  static_assert(146097 * ERAS - 719469 - int64_t(EPOCH) <= INT32_MAX &&
+    146097 * ERAS - 719469 - int64_t(EPOCH) - REV_MAX >= INT32_MIN,
+    "Epoch out of range");
+
+  int32_t static constexpr rata_die_max = 146097 * ERAS - 719469 - EPOCH;
+  int32_t static constexpr rata_die_min = rata_die_max - int32_t(REV_MAX);
+
+  // Dates whose rata dies are in the range above:
+  static date32_t constexpr date_min =
+    epoch::gregorian_date(int64_t(rata_die_min) + EPOCH);
+  static date32_t constexpr date_max =
+    epoch::gregorian_date(int64_t(rata_die_max) + EPOCH);
+
   static uint32_t constexpr C1 = 3853261555; // floor(2^47*4/146097)
   static uint32_t constexpr C2 = 3010298776; // ceil(2^40*4/1461)
   static uint32_t constexpr C3 = 2006057;    // ceil(2^32/2141)
 
   static inline
   date32_t to_date(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return { int32_t(p.year), p.month, p.day + 1 };
+  }
+
+  // The below is identical to benjoffe_fast64.hpp
+  static uint32_t constexpr R_ERAS =
+    (int64_t(2147483648) - 719468 - EPOCH) / 146097 + 1;
+  static uint32_t constexpr R_SHIFT = 146097 * int64_t(R_ERAS) + 719469 + EPOCH;
+
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    date32_t const date = BOUNDS::check(date32_t{ year, month, day },
+      date_min, date_max);
+    year  = date.year;
+    month = date.month;
+    day   = date.day;
+
+    uint32_t const bump = month <= 2;
+    uint32_t const yrs = uint32_t(year + int32_t(400 * R_ERAS)) - bump;
+    uint32_t const cen = yrs / 100;
+    int32_t const shift = bump ? 8829 : -2919;
+
+    // Similar to Neri-Scheinder but slightly slower to avoid early overflow:
+    uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
+    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
+    
+    return year_days + month_days + day - R_SHIFT;
+  }
+
+  // Monday = 0 to Sunday = 6, see benjoffe_fast64.
+  static inline
+  uint32_t weekday(int32_t dayNumber) {
+    // 1 January 1970 is a Thursday, i.e., 3 days after a Monday:
+    uint64_t const shifted = int64_t(dayNumber) + W_SHIFT;
+    return uint32_t(shifted % 7);
+  }
+
+  // Period truncation, identical to benjoffe_fast64.hpp but for parts.
+
+  static inline
+  int32_t to_week_start(int32_t dayNumber) {
+    return dayNumber - int32_t(weekday(dayNumber));
+  }
+
+  static inline
+  int32_t to_month_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return dayNumber - p.day;
+  }
+
+  static inline
+  int32_t to_quarter_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    // Shifted by multiples of 400 to be non-negative. Given 4 | yrs,
+    // 100 | yrs iff 25 | yrs and 400 | yrs iff 16 | yrs, which avoid
+    // divisions:
+    uint32_t const yrs = p.year + 400 * R_ERAS;
+    uint32_t const leap = (yrs % 4 == 0) &
+      ((yrs % 25 != 0) | (yrs % 16 == 0));
+    return dayNumber - p.day - date_trunc::quarter_offset(p.month, leap);
+  }
+
+  static inline
+  int32_t to_year_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    // to_rata_die(year, 1, 1) simplified:
+    uint32_t const yrs = p.year + 400 * R_ERAS - 1;
+    uint32_t const cen = yrs / 100;
+    return yrs * 365 + yrs / 4 - cen + cen / 4 + 307 - R_SHIFT;
+  }
+
+  // 12 * year + month - 1, e.g., for histograms by month, from parts()
+  // without the day.
+  static inline
+  int32_t to_month_index(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return int32_t(p.year * 12 + p.month - 1);
+  }
+
+private:
+
+  static uint64_t constexpr W_SHIFT = 7 * (uint64_t(1) << 31) + 3 + EPOCH;
+
+  struct parts_t {
+    uint32_t year;
+    uint32_t month;
+    uint32_t day;   // 0-indexed
+  };
+
+  // The decoding of to_date, with the day 0-indexed, see benjoffe_fast64.
+  static inline
+  parts_t parts(int32_t dayNumber) {
+
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
       
     // 1. Adjust for 100/400 leap year rule.
     // Reverse day count technique explained in article [3]
@@ -76,13 +191,10 @@ struct benjoffe_fast32 {
     uint32_t const yrs = (jul * uint64_t(C2)) >> 40;
     uint32_t const rem = jul - yrs * 1461 / 4;
 
-  #if IS_ARM
-    uint32_t const shift = 979360;                       
-  #else
-    // Jan/Feb cutoff when counting backwards:
-    uint32_t const bump = rem <= 59;
-    uint32_t const shift = bump ? 192928 : 979360;
-  #endif
+    // Jan/Feb cutoff when counting backwards, unless the variant bumps late
+    // (see eaf/variant.hpp):
+    uint32_t const early = rem <= 59;
+    uint32_t const shift = !VARIANT::late_bump && early ? 192928 : 979360;
 
     // Neri-Schneider technique for Day and Month [1]:
     // Adapted to use the shift technique and a
@@ -91,36 +203,24 @@ struct benjoffe_fast32 {
     uint32_t const M = N / 65536;
     uint32_t const D = ((N % 65536) * uint64_t(C3)) >> 32;
 
-  #if IS_ARM
-    uint32_t const bump = M > 12;
-    uint32_t const month = bump ? M - 12 : M;
-  #else
-    uint32_t const month = M;
-  #endif
+    uint32_t const late = M > 12;
+    uint32_t const bump = VARIANT::late_bump ? late : early;
+    uint32_t const month = VARIANT::late_bump && late ? M - 12 : M;
 
-    uint32_t const day = D + 1;
-    int32_t const year = Y_SHIFT - yrs + bump;
-
-    return { year, month, day };
+    return { Y_SHIFT - yrs + bump, month, D };
   }
 
-  static inline
-  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
-
-    uint32_t const bump = month <= 2;
-    uint32_t const yrs = uint32_t(year + 5880000) - bump;
-    uint32_t const cen = yrs / 100;
-    int32_t const shift = bump ? 8829 : -2919;
-
-    // Similar to Neri-Scheinder but slightly slower to avoid early overflow:
-    uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
-    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
-    
-    return year_days + month_days + day - 2148345369u;
-  }
+}; // struct benjoffe_fast32_t
 
-}; // struct benjoffe_fast32
+using benjoffe_fast32        = benjoffe_fast32_t<>;
+using benjoffe_fast32_dotnet = benjoffe_fast32_t<epoch::dotnet>;
+using benjoffe_fast32_ole    = benjoffe_fast32_t<epoch::ole>;
+using benjoffe_fast32_mjd    = benjoffe_fast32_t<epoch::mjd>;
+using benjoffe_fast32_jdn    = benjoffe_fast32_t<epoch::jdn>;
 
-#undef IS_ARM
+using benjoffe_fast32_x86 = benjoffe_fast32_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::x86>;
+using benjoffe_fast32_arm = benjoffe_fast32_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::arm>;
 
 #endif // EAF_ALGORITHMS_BENJOFFE_FAST32_H
@@ -28,16 +28,16 @@
 #define EAF_ALGORITHMS_BENJOFFE_FAST32_WIDE_H
 
 #include "eaf/date.hpp"
+#include "eaf/bounds.hpp"
+#include "eaf/variant.hpp"
+#include "util/epoch.hpp"
 
 #include <stdint.h>
 
-#if defined(__aarch64__) || defined(_M_ARM64)
-#define IS_ARM 1
-#else
-#define IS_ARM 0
-#endif
-
-struct benjoffe_fast32_wide {
+template <int32_t EPOCH = epoch::unix_time,
+  typename BOUNDS = eaf::bounds::unchecked,
+  typename VARIANT = eaf::variant::native>
+struct benjoffe_fast32_wide_t {
 
   // Fast wide 32-bit algorithm.
   // Supports full signed 32-bit input range, using
@@ -52,10 +52,30 @@ struct benjoffe_fast32_wide {
   // Backwards-counting technique explained in:
   // [3] https://www.benjoffe.com/fast-date-64
 
-  static uint32_t constexpr D_SHIFT = 146097 * 6 - 719162 - 307 + 3845;
-  // Note: 14693 is intentional
+  // Day numbers count from EPOCH, see benjoffe_fast64.
+
+  // Reference point of bucket 0 is the last day of February of a year
+  // multiple of 400, i.e., d0 = D_SHIFT is rata die 146097 * (ERAS - 14699)
+  // - 719469 (where 3845 = 2^31 mod 146097.) ERAS is the smallest keeping
+  // rev non-negative in bucket 0, e.g., ERAS = 6 for the Unix epoch. Then
+  // rev is, at most, D_SHIFT + 32767 * (146097 - 2^17), well within the
+  // range where C1 and C2 are exact (see benjoffe_fast32::REV_MAX.)
+  static int32_t constexpr ERAS =
+    (int64_t(EPOCH) + 846695 + 146097ll * 14700 + 146096) / 146097 - 14700;
+  static uint32_t constexpr D_SHIFT = 146097 * int64_t(ERAS) - 719162 - 307 +
+    3845 - EPOCH;
+  // Note: 14699 - ERAS = 14693 for the Unix epoch is intentional
   //       = round((2^31 - 719468)/146097) - 1
-  static uint32_t constexpr Y_SHIFT = 14693 * 400 + 1;
+  static uint32_t constexpr Y_SHIFT = (14699 - ERAS) * 400 + 1;
+
+  int32_t static constexpr rata_die_min = INT32_MIN;
+  int32_t static constexpr rata_die_max = INT32_MAX;
+
+  // Dates whose rata dies are in the range above:
+  static date32_t constexpr date_min =
+    epoch::gregorian_date(int64_t(rata_die_min) + EPOCH);
+  static date32_t constexpr date_max =
+    epoch::gregorian_date(int64_t(rata_die_max) + EPOCH);
 
   // Bucket technique explained in article [2]
   // Note: when counting backwards, a bucket size can correspond
@@ -69,6 +89,8 @@ struct benjoffe_fast32_wide {
 
   static inline
   date32_t to_date(int32_t dayNumber) {
+
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
     
     uint32_t const d0 = dayNumber + 2147483648;
 
@@ -88,13 +110,10 @@ struct benjoffe_fast32_wide {
     uint32_t const yrs = jul * uint64_t(C2) >> 40;
     uint32_t const rem = jul - yrs * 1461 / 4;
 
-  #if IS_ARM
-    uint32_t const shift = 979360;                       
-  #else
-    // Jan/Feb cutoff when counting backwards:
-    uint32_t const bump = rem <= 59;
-    uint32_t const shift = bump ? 192928 : 979360;
-  #endif
+    // Jan/Feb cutoff when counting backwards, unless the variant bumps late
+    // (see eaf/variant.hpp):
+    uint32_t const early = rem <= 59;
+    uint32_t const shift = !VARIANT::late_bump && early ? 192928 : 979360;
 
     // Neri-Schneider technique for Day and Month [1]:
     // Adapted to use the shift technique and a
@@ -103,12 +122,9 @@ struct benjoffe_fast32_wide {
     uint32_t const M = N / 65536;
     uint32_t const D = ((N % 65536) * uint64_t(C3)) >> 32;
 
-  #if IS_ARM
-    uint32_t const bump = M > 12;
-    uint32_t const month = bump ? M - 12 : M;
-  #else
-    uint32_t const month = M;
-  #endif
+    uint32_t const late = M > 12;
+    uint32_t const bump = VARIANT::late_bump ? late : early;
+    uint32_t const month = VARIANT::late_bump && late ? M - 12 : M;
 
     uint32_t const day = D + 1;
     int32_t const year = BUCK_Y*bucket - Y_SHIFT - yrs + bump;
@@ -118,11 +134,21 @@ struct benjoffe_fast32_wide {
 
   // The below is identical to benjoffe_fast64.hpp
   // It is therefore excluded in the to_rata_die benchmarks
+  static uint32_t constexpr R_ERAS =
+    (int64_t(2147483648) - 719468 - EPOCH) / 146097 + 1;
+  static uint32_t constexpr R_SHIFT = 146097 * int64_t(R_ERAS) + 719469 + EPOCH;
+
   static inline
   int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
 
+    date32_t const date = BOUNDS::check(date32_t{ year, month, day },
+      date_min, date_max);
+    year  = date.year;
+    month = date.month;
+    day   = date.day;
+
     uint32_t const bump = month <= 2;
-    uint32_t const yrs = uint32_t(year + 5880000) - bump;
+    uint32_t const yrs = uint32_t(year + int32_t(400 * R_ERAS)) - bump;
     uint32_t const cen = yrs / 100;
     int32_t const shift = bump ? 8829 : -2919;
 
@@ -130,11 +156,20 @@ struct benjoffe_fast32_wide {
     uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
     uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
     
-    return year_days + month_days + day - 2148345369u;
+    return year_days + month_days + day - R_SHIFT;
   }
 
-}; // struct benjoffe_fast32_wide
+}; // struct benjoffe_fast32_wide_t
+
+using benjoffe_fast32_wide        = benjoffe_fast32_wide_t<>;
+using benjoffe_fast32_wide_dotnet = benjoffe_fast32_wide_t<epoch::dotnet>;
+using benjoffe_fast32_wide_ole    = benjoffe_fast32_wide_t<epoch::ole>;
+using benjoffe_fast32_wide_mjd    = benjoffe_fast32_wide_t<epoch::mjd>;
+using benjoffe_fast32_wide_jdn    = benjoffe_fast32_wide_t<epoch::jdn>;
 
-#undef IS_ARM
+using benjoffe_fast32_wide_x86 = benjoffe_fast32_wide_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::x86>;
+using benjoffe_fast32_wide_arm = benjoffe_fast32_wide_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::arm>;
 
 #endif // EAF_ALGORITHMS_BENJOFFE_FAST32_WIDE_H
@@ -28,35 +28,54 @@
 #define EAF_ALGORITHMS_BENJOFFE_FAST64_H
 
 #include "eaf/date.hpp"
-#include "algorithms/_portable_uint128.hpp"
+#include "eaf/bounds.hpp"
+#include "eaf/mul128.hpp"
+#include "eaf/variant.hpp"
+#include "util/date_trunc.hpp"
+#include "util/epoch.hpp"
 
 #include <stdint.h>
 
-#if defined(__aarch64__) || defined(_M_ARM64)
-#define IS_ARM 1
-#else
-#define IS_ARM 0
-#endif
-
-struct benjoffe_fast64 {
+template <int32_t EPOCH = epoch::unix_time,
+  typename BOUNDS = eaf::bounds::unchecked,
+  typename VARIANT = eaf::variant::native,
+  typename MUL = eaf::mul128::native>
+struct benjoffe_fast64_t {
 
   // Very fast algorithm.
   // See the following blog post for explanation and benchmark results:
   // https://www.benjoffe.com/fast-date-64
+  //
+  // Day numbers count from EPOCH, given as a rata die (days since 1 January
+  // 1970), which is folded into the shift constants below. See
+  // util/epoch.hpp for common epochs.
 
   // Shift constants for working with positive numbers.
-  // ERAS = 14704 supports full signed 32-bit input range.
+  // The smallest ERAS that keeps rev non-negative for INT32_MAX supports
+  // full signed 32-bit input range, e.g., ERAS = 14704 for the Unix epoch.
   // ERAS = 4726498270 is suitable for 64-bit input range.
-  static uint32_t constexpr ERAS = 14704;
-  static uint32_t constexpr D_SHIFT = 146097 * ERAS - 719469;
+  static uint32_t constexpr ERAS =
+    (int64_t(INT32_MAX) + 719469 + EPOCH + 146096) / 146097;
+  static uint64_t constexpr D_SHIFT = 146097 * int64_t(ERAS) - 719469 - EPOCH;
   static uint32_t constexpr Y_SHIFT = 400 * ERAS - 1;
 
-#if IS_ARM
-  // ARM benefits from smaller constants
-  static uint32_t constexpr SCALE = 1;
-#else
-  static uint32_t constexpr SCALE = 32;
-#endif
+  // Shift constants for to_rata_die. The smallest R_ERAS that keeps yrs
+  // non-negative for INT32_MIN supports full signed 32-bit output range.
+  static uint32_t constexpr R_ERAS =
+    (int64_t(2147483648) - 719468 - EPOCH) / 146097 + 1;
+  static uint32_t constexpr R_SHIFT = 146097 * int64_t(R_ERAS) + 719469 + EPOCH;
+
+  int32_t static constexpr rata_die_min = INT32_MIN;
+  int32_t static constexpr rata_die_max = INT32_MAX;
+
+  // Dates whose rata dies are in the range above:
+  static date32_t constexpr date_min =
+    epoch::gregorian_date(int64_t(rata_die_min) + EPOCH);
+  static date32_t constexpr date_max =
+    epoch::gregorian_date(int64_t(rata_die_max) + EPOCH);
+
+  // ARM benefits from smaller constants (see eaf/variant.hpp):
+  static uint32_t constexpr SCALE = VARIANT::scale;
 
   static uint32_t constexpr SHIFT_0 = 30556 * SCALE;
   static uint32_t constexpr SHIFT_1 = 5980 * SCALE;
@@ -72,14 +91,114 @@ struct benjoffe_fast64 {
    */
   static inline
   date32_t to_date(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    // Normalize from 0-index to 1-index Day:
+    return date32_t{int32_t(p.year), p.month, p.day + 1};
+  }
+
+  // Fast overflow-safe inverse function.
+  // Accurate over the full signed 32-bit output range.
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    date32_t const date = BOUNDS::check(date32_t{ year, month, day },
+      date_min, date_max);
+    year  = date.year;
+    month = date.month;
+    day   = date.day;
+
+    uint32_t const bump = month <= 2;
+    uint32_t const yrs = uint32_t(year + int32_t(400 * R_ERAS)) - bump;
+    uint32_t const cen = yrs / 100;
+    int32_t const shift = bump ? 8829 : -2919;
+
+    // Similar to Neri-Scheinder but slightly slower to avoid early overflow:
+    uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
+    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
+    
+    return year_days + month_days + day - R_SHIFT;
+  }
+
+  // Day of the week, Monday = 0 to Sunday = 6 (ISO 8601's less 1). The
+  // input is shifted by a multiple of 7 to be non-negative, for % 7 to be a
+  // mul-shift.
+  static inline
+  uint32_t weekday(int32_t dayNumber) {
+    // 1 January 1970 is a Thursday, i.e., 3 days after a Monday:
+    uint64_t const shifted = int64_t(dayNumber) + W_SHIFT;
+    return uint32_t(shifted % 7);
+  }
+
+  // Period truncation, see util/date_trunc.hpp. Rather than decoding the
+  // date and encoding the first day of the period, the day of month found
+  // by to_date is subtracted from the input, as is the quarter offset. Only
+  // the year start encodes, and only the year. Results are exact where
+  // representable.
+
+  static inline
+  int32_t to_week_start(int32_t dayNumber) {
+    return dayNumber - int32_t(weekday(dayNumber));
+  }
+
+  static inline
+  int32_t to_month_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return dayNumber - p.day;
+  }
+
+  static inline
+  int32_t to_quarter_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    // Shifted by multiples of 400 to be non-negative. Given 4 | yrs,
+    // 100 | yrs iff 25 | yrs and 400 | yrs iff 16 | yrs, which avoid
+    // divisions:
+    uint32_t const yrs = p.year + 400 * R_ERAS;
+    uint32_t const leap = (yrs % 4 == 0) &
+      ((yrs % 25 != 0) | (yrs % 16 == 0));
+    return dayNumber - p.day - date_trunc::quarter_offset(p.month, leap);
+  }
+
+  static inline
+  int32_t to_year_start(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    // to_rata_die(year, 1, 1) simplified:
+    uint32_t const yrs = p.year + 400 * R_ERAS - 1;
+    uint32_t const cen = yrs / 100;
+    return yrs * 365 + yrs / 4 - cen + cen / 4 + 307 - R_SHIFT;
+  }
+
+  // 12 * year + month - 1, see benjoffe_fast32.
+  static inline
+  int32_t to_month_index(int32_t dayNumber) {
+    parts_t const p = parts(dayNumber);
+    return int32_t(p.year * 12 + p.month - 1);
+  }
+
+private:
+
+  static uint64_t constexpr W_SHIFT = 7 * (uint64_t(1) << 31) + 3 + EPOCH;
+
+  struct parts_t {
+    uint32_t year;
+    uint32_t month;
+    uint32_t day;   // 0-indexed
+  };
+
+  // The decoding of to_date, with the day 0-indexed. The period
+  // truncations and to_month_index use it too; the values they do not need
+  // are optimised away.
+  static inline
+  parts_t parts(int32_t dayNumber) {
+
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
     
     // 1. Adjust for 100/400 leap year rule.
     // Reverse day count:
-    uint64_t const rev = D_SHIFT - dayNumber;
+    uint64_t const rev = D_SHIFT - int64_t(dayNumber);
     // Mul-shift to divide by 36524.25 (days per average century):
     // Note: ARM could be faster with simpler math, but using same
     // technique everywhere to ensure identical range.
-    uint64_t const cen = uint128_t(C1) * rev >> 64;      
+    uint64_t const cen = MUL::mulh(C1, rev);      
     // Julian map:
     uint64_t const jul = rev - cen / 4 + cen;            
 
@@ -87,63 +206,60 @@ struct benjoffe_fast64 {
     // Mul-shift to divide by 365.25:
     // Note: ARM could be faster with simpler math, but using same
     // technique everywhere to ensure identical range.
-    uint128_t const num = uint128_t(C2) * jul; 
-    uint32_t const yrs = Y_SHIFT - uint32_t(num >> 64); // Forward year 
-    uint64_t const low = uint64_t(num);         // Remainder
+    uint64_t num;                                 // Quotient
+    uint64_t const low = MUL::mul(C2, jul, &num); // Remainder
+    uint32_t const yrs = Y_SHIFT - uint32_t(num); // Forward year
     
     // Year-part:
     // EAF technique similar to Neri-Schneider, but instead of
     // calculating day-of-year, we calculate an input to `N`.
-    uint32_t const ypt = uint32_t(uint128_t(24451 * SCALE) * low >> 64);
+    uint32_t const ypt = uint32_t(MUL::mulh(24451 * SCALE, low));
 
-  #if IS_ARM
-    // Perform bump later for faster code on Apple Silicon.
-    uint32_t const shift = SHIFT_0;
-  #else
-    uint32_t const bump = ypt < (3952 * SCALE);      // Jan or Feb
-    uint32_t const shift = bump ? SHIFT_1 : SHIFT_0; // Shift offset
-  #endif
+    // The ARM variant performs the bump later for faster code on Apple
+    // Silicon (see eaf/variant.hpp).
+    uint32_t const early = ypt < (3952 * SCALE);             // Jan or Feb
+    uint32_t const shift = !VARIANT::late_bump && early ? SHIFT_1 : SHIFT_0;
 
     // 3. Year-modulo-bitshift for leap years,
     // also revert to forward direction.
     uint32_t const N = (yrs % 4) * (16 * SCALE) + shift - ypt;
     uint32_t const M = N / (2048 * SCALE);
-    uint32_t const D = uint32_t(uint128_t(C3) * (N % (2048 * SCALE)) >> 64);
+    uint32_t const D = uint32_t(MUL::mulh(C3, N % (2048 * SCALE)));
 
-  #if IS_ARM
-    uint32_t const bump = M > 12;             // Jan or Feb:
-    uint32_t const month = bump ? M - 12 : M; // Single-cycle on ARM:    
-  #else
-    uint32_t const month = M; // Already correct due to prior shift
-  #endif
+    // Late bump (single-cycle on ARM), otherwise the month is already
+    // correct due to the prior shift:
+    uint32_t const late = M > 12;                            // Jan or Feb
+    uint32_t const bump = VARIANT::late_bump ? late : early;
+    uint32_t const month = VARIANT::late_bump && late ? M - 12 : M;
 
-    // Normalize from 0-index to 1-index Day:
-    uint32_t const day = D + 1;
     // Overflow year when Jan or Feb:
-    int32_t const year = yrs + bump;
-
-    return date32_t{year, month, day};
+    return { yrs + bump, month, D };
   }
 
-  // Fast overflow-safe inverse function.
-  // Accurate over the full signed 32-bit output range.
-  static inline
-  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+}; // struct benjoffe_fast64_t
 
-    uint32_t const bump = month <= 2;
-    uint32_t const yrs = uint32_t(year + 5880000) - bump;
-    uint32_t const cen = yrs / 100;
-    int32_t const shift = bump ? 8829 : -2919;
+using benjoffe_fast64        = benjoffe_fast64_t<>;
+using benjoffe_fast64_dotnet = benjoffe_fast64_t<epoch::dotnet>;
+using benjoffe_fast64_ole    = benjoffe_fast64_t<epoch::ole>;
+using benjoffe_fast64_mjd    = benjoffe_fast64_t<epoch::mjd>;
+using benjoffe_fast64_jdn    = benjoffe_fast64_t<epoch::jdn>;
 
-    // Similar to Neri-Scheinder but slightly slower to avoid early overflow:
-    uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
-    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
-    
-    return year_days + month_days + day - 2148345369u;
-  }
+using benjoffe_fast64_portable = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::native, eaf::mul128::portable>;
+#if defined(__BMI2__)
+using benjoffe_fast64_mulx = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::native, eaf::mul128::mulx>;
+#endif
 
-}; // struct benjoffe_fast64
+using benjoffe_fast64_x86 = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::x86>;
+using benjoffe_fast64_arm = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::arm>;
 
-#undef IS_ARM
+// The bump and the SCALE swapped between the variants:
+using benjoffe_fast64_x86_scale1 = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::variant_t<false, 1>>;
+using benjoffe_fast64_arm_scale32 = benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, eaf::variant::variant_t<true, 32>>;
 
 #endif // EAF_ALGORITHMS_BENJOFFE_FAST64_H
@@ -9,6 +9,7 @@
 #include "algorithms_ordinal/ordinal_benjoffe_fast64.hpp"
 #include "algorithms/benjoffe_fast64.hpp"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(__aarch64__) || defined(_M_ARM64)
@@ -25,9 +26,12 @@ struct benjoffe_ordinal_alternative {
   //
   // See the 'algorithms_ordinal' folder for general rata-die to year/ordinal/leap algorithms.
   //
-  // This is built as a standard YMD algorithm in this codebase for two reasons:
-  // 1. I haven't spent time creating a test suite for this specific scenario
-  // 2. It is interesting to see what the overall "penalty" is for calculating dates this way.
+  // This is built as a standard YMD algorithm in this codebase because
+  // it is interesting to see what the overall "penalty" is for calculating dates this way.
+  //
+  // The (year, ordinal) kernels are also exposed on their own, see
+  // ordinal_to_month_day, month_day_to_ordinal and ordinal_to_rata_die
+  // (tested in tests/ordinal_tests.cpp).
 
 #if IS_ARM
   // ARM benefits from smaller constants
@@ -49,24 +53,9 @@ struct benjoffe_ordinal_alternative {
 
     // Reuse other fast algorithm for setting up the variables we need
     ordinal32_t const alt = ordinal_benjoffe_fast64::to_date(dayNumber);
-    int32_t const year = alt.year;
-    uint32_t const ordinal = alt.ordinal;
-    bool const leap = alt.leap;
-    
-    // The logic below is where this algorithm really begins.
-    // It is similar to the algorithm presented in Calendrical Calculations, but:
-    // 1. Performs a shift after multiplication by STEP instead of prior
-    // 2. Uses a scaled ratio so that the divisor is a power of 2 (as used already by time-rs).
-    // 3. Uses the Neri-Schneider technique to use high and low parts of multiplication.
-    // 4. Uses platform specific scale for micro optimisations (ARM vs x86).
-
-    uint32_t jan_feb_len = 59 + leap;
-    uint32_t shift = ordinal <= jan_feb_len ? SHIFT_0 : (leap ? SHIFT_1 : SHIFT_2);
-    uint32_t num = ordinal * STEP + shift;
-    uint32_t month = num / DIVISOR;
-    uint32_t day = (num % DIVISOR) / STEP + 1;
-
-    return { year, month, day };
+    month_day_t const md = ordinal_to_month_day(alt.ordinal, alt.leap);
+
+    return { alt.year, md.month, md.day };
   }
 
   static inline
@@ -74,6 +63,76 @@ struct benjoffe_ordinal_alternative {
     return benjoffe_fast64::to_rata_die(year, month, day);
   }
 
+  /**
+   * Converts a 1-indexed day-of-year to month and day.
+   *
+   * This is where this algorithm really begins.
+   * It is similar to the algorithm presented in Calendrical Calculations, but:
+   * 1. Performs a shift after multiplication by STEP instead of prior
+   * 2. Uses a scaled ratio so that the divisor is a power of 2 (as used already by time-rs).
+   * 3. Uses the Neri-Schneider technique to use high and low parts of multiplication.
+   * 4. Uses platform specific scale for micro optimisations (ARM vs x86).
+   */
+  static inline
+  month_day_t ordinal_to_month_day(uint32_t ordinal, bool leap) {
+
+    uint32_t const jan_feb_len = 59 + leap;
+    uint32_t const shift = ordinal <= jan_feb_len ? SHIFT_0 : (leap ? SHIFT_1 : SHIFT_2);
+    uint32_t const num = ordinal * STEP + shift;
+    uint32_t const month = num / DIVISOR;
+    uint32_t const day = (num % DIVISOR) / STEP + 1;
+
+    return { month, day };
+  }
+
+  // Batch form of the above. The loop has no data-dependent control flow,
+  // so compilers are free to vectorise it.
+  static inline
+  void ordinal_to_month_day(uint32_t const* ordinals, bool const* leaps,
+    uint32_t* months, uint32_t* days, size_t count) {
+
+    for (size_t i = 0; i < count; ++i) {
+      month_day_t const md = ordinal_to_month_day(ordinals[i], leaps[i]);
+      months[i] = md.month;
+      days[i] = md.day;
+    }
+  }
+
+  /**
+   * Inverse of ordinal_to_month_day.
+   *
+   * Days before the 1st of the month use the Neri-Schneider month numerator
+   * 979 / 32 with a Jan/Feb dependent offset, so the only data dependence on
+   * leap years is the final addition.
+   */
+  static inline
+  uint32_t month_day_to_ordinal(uint32_t month, uint32_t day, bool leap) {
+
+    uint32_t const bump = month <= 2;
+    uint32_t const shift = bump ? 963 : 1031;
+    uint32_t const month_days = (979 * month - shift) / 32;
+
+    return month_days + day + (leap & !bump);
+  }
+
+  /**
+   * Rata die of a (year, day-of-year) pair without going through month/day.
+   * This is benjoffe_fast64::to_rata_die specialised for 1 January, with
+   * its shift constants, so it has the same range of validity.
+   */
+  static inline
+  int32_t ordinal_to_rata_die(int32_t year, uint32_t ordinal) {
+
+    using F = benjoffe_fast64;
+
+    uint32_t const yrs = uint32_t(year + int32_t(400 * F::R_ERAS)) - 1;
+    uint32_t const cen = yrs / 100;
+    uint32_t const year_days = yrs * 365 + yrs / 4 - cen + cen / 4;
+
+    // 306 days from 1 March to 1 January, as month_days in to_rata_die:
+    return year_days + ordinal - (F::R_SHIFT - 306);
+  }
+
 }; // struct benjoffe_ordinal_alternative
 
 #undef IS_ARM
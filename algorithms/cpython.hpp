@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: PSF-2.0
+// SPDX-SnippetCopyrightText: Copyright (c) 2001 Python Software Foundation; All Rights Reserved
+
+/**
+ * @file cpython.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from CPython's datetime
+ * module [1] (Modules/_datetimemodule.c).
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://www.python.org
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_CPYTHON_HPP
+#define EAF_ALGORITHMS_CPYTHON_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct cpython {
+
+  // Original epoch: 1 January 1 is ordinal 1 (date.toordinal()).
+  static constexpr int32_t ajustment = 719163;
+
+  // https://github.com/python/cpython/blob/main/Modules/_datetimemodule.c
+  // (ord_to_ymd)
+  static inline
+  date32_t to_date(int32_t rata_die) {
+
+    int ordinal = rata_die + ajustment;
+    int year, month, day;
+
+    int n, n1, n4, n100, n400, leapyear, preceding;
+
+    --ordinal;
+    n400 = ordinal / DI400Y;
+    n = ordinal % DI400Y;
+    year = n400 * 400 + 1;
+
+    n100 = n / DI100Y;
+    n = n % DI100Y;
+
+    n4 = n / DI4Y;
+    n = n % DI4Y;
+
+    n1 = n / 365;
+    n = n % 365;
+
+    year += n100 * 100 + n4 * 4 + n1;
+    if (n1 == 4 || n100 == 4) {
+      year -= 1;
+      month = 12;
+      day = 31;
+      return { int32_t(year), uint32_t(month), uint32_t(day) };
+    }
+
+    leapyear = n1 == 3 && (n4 != 24 || n100 == 3);
+    month = (n + 50) >> 5;
+    preceding = (_days_before_month[month] + (month > 2 && leapyear));
+    if (preceding > n) {
+      /* estimate is too large */
+      month -= 1;
+      preceding -= days_in_month(year, month);
+    }
+    n -= preceding;
+
+    day = n + 1;
+
+    return { int32_t(year), uint32_t(month), uint32_t(day) };
+  }
+
+  // https://github.com/python/cpython/blob/main/Modules/_datetimemodule.c
+  // (ymd_to_ord)
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+    int ordinal = days_before_year(year) + days_before_month(year, month) +
+      int(day);
+    return ordinal - ajustment;
+  }
+
+private:
+
+  // https://github.com/python/cpython/blob/main/Modules/_datetimemodule.c
+  static int constexpr DI4Y   = 1461;   /* days_before_year(5); days in 4 years */
+  static int constexpr DI100Y = 36524;  /* days_before_year(101); days in 100 years */
+  static int constexpr DI400Y = 146097; /* days_before_year(401); days in 400 years  */
+
+  static int constexpr _days_in_month[] = {
+    0, /* unused; this vector uses 1-based indexing */
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+  };
+
+  static int constexpr _days_before_month[] = {
+    0, /* unused; this vector uses 1-based indexing */
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+  };
+
+  /* year -> 1 if leap year, else 0. */
+  static inline
+  int is_leap(int year)
+  {
+    /* Cast year to unsigned.  The result is the same either way, but
+     * C can generate faster code for unsigned mod than for signed
+     * mod (especially for % 4 -- a good compiler should just grab
+     * the last 2 bits when the LHS is unsigned).
+     */
+    const unsigned int ayear = (unsigned int)year;
+    return ayear % 4 == 0 && (ayear % 100 != 0 || ayear % 400 == 0);
+  }
+
+  /* year, month -> number of days in that month in that year */
+  static inline
+  int days_in_month(int year, int month)
+  {
+    if (month == 2 && is_leap(year))
+      return 29;
+    else
+      return _days_in_month[month];
+  }
+
+  /* year, month -> number of days in year preceding first day of month */
+  static inline
+  int days_before_month(int year, int month)
+  {
+    int days;
+
+    days = _days_before_month[month];
+    if (month > 2 && is_leap(year))
+      ++days;
+    return days;
+  }
+
+  /* year -> number of days before January 1st of year.  Remember that we
+   * start with year 1, so days_before_year(1) == 0.
+   */
+  static inline
+  int days_before_year(int year)
+  {
+    int y = year - 1;
+    /* This is incorrect if year <= 0; we really want the floor
+     * here.  But so long as MINYEAR is 1, the smallest year this
+     * can see is 1.
+     */
+    return y*365 + y/4 - y/100 + y/400;
+  }
+
+}; // struct cpython
+
+#endif // EAF_ALGORITHMS_CPYTHON_HPP
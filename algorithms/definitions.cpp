@@ -14,9 +14,13 @@
  */
 
 #include "dotnet.hpp"
+#include "duckdb.hpp"
 #include "glibc.hpp"
 
 int constexpr dotnet::s_daysToMonth365[];
 int constexpr dotnet::s_daysToMonth366[];
 
+int32_t constexpr duckdb::CUMULATIVE_DAYS[];
+int32_t constexpr duckdb::CUMULATIVE_LEAP_DAYS[];
+
 unsigned short int constexpr glibc::undesrcore_mon_yday[2][13];
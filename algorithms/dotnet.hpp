@@ -18,6 +18,7 @@
 #define EAF_ALGORITHMS_DOTNET_HPP
 
 #include "eaf/date.hpp"
+#include "eaf/slow_paths.hpp"
 
 #include <cstdint>
 
@@ -45,7 +46,10 @@ struct dotnet {
     bool leapYear = y1 == 3 && (y4 != 24 || y100 == 3);
     int const* days = leapYear ? s_daysToMonth366 : s_daysToMonth365;
     int m = (n >> 5) + 1;
-    while (n >= days[m]) m++;
+    while (n >= days[m]) {
+      EAF_SLOW_PATH(dotnet_month_loop);
+      m++;
+    }
     int month = m;
     int day = n - days[m - 1] + 1;
 
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+// SPDX-SnippetCopyrightText: Copyright 2018-2025 Stichting DuckDB Foundation
+
+/**
+ * @file duckdb.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from DuckDB [1].
+ *
+ * DuckDB's tables are literals, generated here at compile time, and
+ * Date::FromDate's validation (which throws) is omitted.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://duckdb.org
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_DUCKDB_HPP
+#define EAF_ALGORITHMS_DUCKDB_HPP
+
+#include "eaf/date.hpp"
+
+#include <array>
+#include <cstdint>
+
+struct duckdb {
+
+  // Original epoch: 1 January 1970.
+
+  // https://github.com/duckdb/duckdb/blob/main/src/common/types/date.cpp
+  // (Date::Convert)
+  static inline
+  date32_t to_date(int32_t n) {
+
+    int32_t year, month, day;
+    int32_t year_offset;
+    ExtractYearOffset(n, year, year_offset);
+
+    day = n - CUMULATIVE_YEAR_DAYS[year_offset];
+
+    bool is_leap_year = (CUMULATIVE_YEAR_DAYS[year_offset + 1] -
+      CUMULATIVE_YEAR_DAYS[year_offset]) == 366;
+    if (is_leap_year) {
+      month = LEAP_MONTH_PER_DAY_OF_YEAR[day];
+      day -= CUMULATIVE_LEAP_DAYS[month - 1];
+    } else {
+      month = MONTH_PER_DAY_OF_YEAR[day];
+      day -= CUMULATIVE_DAYS[month - 1];
+    }
+    day++;
+
+    return { year, uint32_t(month), uint32_t(day) };
+  }
+
+  // https://github.com/duckdb/duckdb/blob/main/src/common/types/date.cpp
+  // (Date::FromDate)
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    int32_t n = 0;
+    while (year < 1970) {
+      year += YEAR_INTERVAL;
+      n -= DAYS_PER_YEAR_INTERVAL;
+    }
+    while (year >= 2370) {
+      year -= YEAR_INTERVAL;
+      n += DAYS_PER_YEAR_INTERVAL;
+    }
+    n += CUMULATIVE_YEAR_DAYS[year - 1970];
+    n += IsLeapYear(year) ? CUMULATIVE_LEAP_DAYS[month - 1] :
+      CUMULATIVE_DAYS[month - 1];
+    n += day - 1;
+
+    return n;
+  }
+
+private:
+
+  static int32_t constexpr EPOCH_YEAR = 1970;
+  static int32_t constexpr YEAR_INTERVAL = 400;
+  static int32_t constexpr DAYS_PER_YEAR_INTERVAL = 146097;
+
+  static int32_t constexpr CUMULATIVE_DAYS[] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 };
+  static int32_t constexpr CUMULATIVE_LEAP_DAYS[] = {
+    0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366 };
+
+  // Days from 1 January 1970 to 1 January of 1970 + i, for i in [0, 400].
+  static constexpr std::array<int32_t, 401> CUMULATIVE_YEAR_DAYS = [](){
+    std::array<int32_t, 401> days{};
+    for (int32_t i = 0, y = EPOCH_YEAR; i < 400; ++i, ++y)
+      days[i + 1] = days[i] + (y % 4 == 0 && (y % 100 != 0 || y % 400 == 0) ?
+        366 : 365);
+    return days;
+  }();
+
+  // Month of each day of the year (the last is unused in common years).
+  static constexpr auto month_per_day_of_year = [](int32_t const* cumulative) {
+    std::array<int8_t, 366> months{};
+    int8_t month = 1;
+    for (int32_t i = 0; i < 366; ++i) {
+      if (month < 12 && i == cumulative[month])
+        ++month;
+      months[i] = month;
+    }
+    return months;
+  };
+
+  static constexpr std::array<int8_t, 366> MONTH_PER_DAY_OF_YEAR =
+    month_per_day_of_year(CUMULATIVE_DAYS);
+  static constexpr std::array<int8_t, 366> LEAP_MONTH_PER_DAY_OF_YEAR =
+    month_per_day_of_year(CUMULATIVE_LEAP_DAYS);
+
+  static inline
+  bool IsLeapYear(int32_t year) {
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+  }
+
+  // https://github.com/duckdb/duckdb/blob/main/src/common/types/date.cpp
+  static inline
+  void ExtractYearOffset(int32_t &n, int32_t &year, int32_t &year_offset) {
+    year = EPOCH_YEAR;
+    // first we normalize n to be in the year range [1970, 2370]
+    // since leap years repeat every 400 years, we can safely normalize just
+    // by "shifting" the CumulativeYearDays array
+    while (n < 0) {
+      n += DAYS_PER_YEAR_INTERVAL;
+      year -= YEAR_INTERVAL;
+    }
+    while (n >= DAYS_PER_YEAR_INTERVAL) {
+      n -= DAYS_PER_YEAR_INTERVAL;
+      year += YEAR_INTERVAL;
+    }
+    // interpolation search
+    // we can find an upper bound of the year by assuming each year has 365
+    // days
+    year_offset = n / 365;
+    // because of leap years we might be off by a little bit: compensate by
+    // decrementing the year offset until we find our year
+    while (n < CUMULATIVE_YEAR_DAYS[year_offset]) {
+      year_offset--;
+    }
+    year += year_offset;
+  }
+
+}; // struct duckdb
+
+#endif // EAF_ALGORITHMS_DUCKDB_HPP
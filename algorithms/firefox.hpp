@@ -16,6 +16,7 @@
 #define EAF_ALGORITHMS_FIREFOX_HPP
 
 #include "eaf/date.hpp"
+#include "eaf/slow_paths.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -86,9 +87,11 @@ struct firefox {
     * be wrong for dates within several hours of a year transition.
     */
     if (t2 > t) {
+      EAF_SLOW_PATH(firefox_year_dec);
       y--;
     } else {
       if (t2 + msPerDay * DaysInYear(y) <= t) {
+        EAF_SLOW_PATH(firefox_year_inc);
         y++;
       }
     }
@@ -18,6 +18,7 @@
 #define EAF_ALGORITHMS_GLIBC_HPP
 
 #include "eaf/date.hpp"
+#include "eaf/slow_paths.hpp"
 
 #include <cstdint>
 
@@ -45,6 +46,8 @@ struct glibc {
 
     while (days < 0 || days >= (underscore_isleap (y) ? 366 : 365))
       {
+        EAF_SLOW_PATH(glibc_year_loop);
+
         /* Guess a corrected year, assuming 365 days per year.  */
         long int yg = y + days / 365 - (days % 365 < 0);
 
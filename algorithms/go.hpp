@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// SPDX-SnippetCopyrightText: Copyright 2009 The Go Authors.
+
+/**
+ * @file go.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from Go's time package [1],
+ * before Go 1.23 (which adopted [2]).
+ *
+ * Go keeps seconds since 1 January of absoluteZeroYear (abs), a year in the
+ * same phase of the 400-year cycle as year 1, and Time.Date() splits them
+ * into days and calls absDate. The normalization of out-of-range months and
+ * days by time.Date() is omitted.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://pkg.go.dev/time
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_GO_HPP
+#define EAF_ALGORITHMS_GO_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct go {
+
+  // Original epoch: 1 January -292277022399 (absoluteZeroYear), in seconds.
+
+  // https://github.com/golang/go/blob/go1.22.0/src/time/time.go (absDate)
+  static inline
+  date32_t to_date(int32_t rata_die) {
+
+    // Go's int64 arithmetic wraps around, hence unsigned here.
+    uint64_t abs = uint64_t(int64_t(rata_die) * secondsPerDay) +
+      uint64_t(unixToAbsolute);
+
+    // Split into time and day.
+    uint64_t d = abs / secondsPerDay;
+
+    // Account for 400 year cycles.
+    uint64_t n = d / daysPer400Years;
+    uint64_t y = 400 * n;
+    d -= daysPer400Years * n;
+
+    // Cut off 100-year cycles.
+    // The last cycle has one extra leap year, so on the last day
+    // of that year, day / daysPer100Years will be 4 instead of 3.
+    // Cut it back down to 3 by subtracting n>>2.
+    n = d / daysPer100Years;
+    n -= n >> 2;
+    y += 100 * n;
+    d -= daysPer100Years * n;
+
+    // Cut off 4-year cycles.
+    // The last cycle has a missing leap year, which does not
+    // affect the computation.
+    n = d / daysPer4Years;
+    y += 4 * n;
+    d -= daysPer4Years * n;
+
+    // Cut off years within a 4-year cycle.
+    // The last year is a leap year, so on the last day of that year,
+    // day / 365 will be 4 instead of 3. Cut it back down to 3
+    // by subtracting n>>2.
+    n = d / 365;
+    n -= n >> 2;
+    y += n;
+    d -= 365 * n;
+
+    int64_t year = int64_t(y) + absoluteZeroYear;
+    int yday = int(d);
+
+    int day = yday;
+    int month;
+    if (isLeap(year)) {
+      // Leap year
+      if (day > 31+29-1) {
+        // After leap day; pretend it wasn't there.
+        day--;
+      } else if (day == 31+29-1) {
+        // Leap day.
+        return { int32_t(year), 2, 29 };
+      }
+    }
+
+    // Estimate month on assumption that every month has 31 days.
+    // The estimate may be too low by at most one month, so adjust.
+    month = day / 31;
+    int end = int(daysBefore[month+1]);
+    int begin;
+    if (day >= end) {
+      month++;
+      begin = end;
+    } else {
+      begin = int(daysBefore[month]);
+    }
+
+    month++; // because January is 1
+    day = day - begin + 1;
+
+    return { int32_t(year), uint32_t(month), uint32_t(day) };
+  }
+
+  // https://github.com/golang/go/blob/go1.22.0/src/time/time.go (Date)
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    uint64_t d = daysSinceEpoch(year);
+
+    // Add in days before this month.
+    d += uint64_t(daysBefore[month-1]);
+    if (isLeap(year) && month >= 3) {
+      d++; // February 29
+    }
+
+    // Add in days before today.
+    d += uint64_t(day - 1);
+
+    uint64_t abs = d * secondsPerDay;
+    int64_t unix = int64_t(abs - uint64_t(unixToAbsolute));
+
+    return int32_t(unix / secondsPerDay);
+  }
+
+private:
+
+  // https://github.com/golang/go/blob/go1.22.0/src/time/time.go
+  static int64_t constexpr secondsPerDay = 86400;
+  static uint64_t constexpr daysPer400Years = 365*400 + 97;
+  static uint64_t constexpr daysPer100Years = 365*100 + 24;
+  static uint64_t constexpr daysPer4Years   = 365*4 + 1;
+
+  static int64_t constexpr absoluteZeroYear = -292277022399;
+
+  // Seconds from 1 January absoluteZeroYear to 1 January 1970: 730692556
+  // 400-year cycles to 1 January 1, then 719162 days.
+  static int64_t constexpr unixToAbsolute =
+    (730692556 * int64_t(daysPer400Years) + 719162) * secondsPerDay;
+
+  // daysBefore[m] counts the number of days in a non-leap year
+  // before month m begins. There is an entry for m=12, counting
+  // the number of days before January of next year (365).
+  static int32_t constexpr daysBefore[] = {
+    0,
+    31,
+    31 + 28,
+    31 + 28 + 31,
+    31 + 28 + 31 + 30,
+    31 + 28 + 31 + 30 + 31,
+    31 + 28 + 31 + 30 + 31 + 30,
+    31 + 28 + 31 + 30 + 31 + 30 + 31,
+    31 + 28 + 31 + 30 + 31 + 30 + 31 + 31,
+    31 + 28 + 31 + 30 + 31 + 30 + 31 + 31 + 30,
+    31 + 28 + 31 + 30 + 31 + 30 + 31 + 31 + 30 + 31,
+    31 + 28 + 31 + 30 + 31 + 30 + 31 + 31 + 30 + 31 + 30,
+    31 + 28 + 31 + 30 + 31 + 30 + 31 + 31 + 30 + 31 + 30 + 31,
+  };
+
+  static inline
+  bool isLeap(int64_t year) {
+    return year%4 == 0 && (year%100 != 0 || year%400 == 0);
+  }
+
+  // daysSinceEpoch takes a year and returns the number of days from
+  // the absolute epoch to the start of that year.
+  // This is basically (year - zeroYear) * 365, but accounting for leap days.
+  static inline
+  uint64_t daysSinceEpoch(int64_t year) {
+    uint64_t y = uint64_t(year - absoluteZeroYear);
+
+    // Add in days from 400-year cycles.
+    uint64_t n = y / 400;
+    y -= 400 * n;
+    uint64_t d = daysPer400Years * n;
+
+    // Add in 100-year cycles.
+    n = y / 100;
+    y -= 100 * n;
+    d += daysPer100Years * n;
+
+    // Add in 4-year cycles.
+    n = y / 4;
+    y -= 4 * n;
+    d += daysPer4Years * n;
+
+    // Add in non-leap years.
+    n = y;
+    d += 365 * n;
+
+    return d;
+  }
+
+}; // struct go
+
+#endif // EAF_ALGORITHMS_GO_HPP
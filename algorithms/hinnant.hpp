@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+// SPDX-SnippetCopyrightText: Copyright (c) 2015, 2016, 2017 Howard Hinnant
+
+/**
+ * @file hinnant.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar by Howard Hinnant [1], as used
+ * by his date library and by std::chrono.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://howardhinnant.github.io/date_algorithms.html
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_HINNANT_HPP
+#define EAF_ALGORITHMS_HINNANT_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+#include <tuple>
+
+struct hinnant {
+
+  // Original epoch: 1 January 1970.
+
+  static inline
+  date32_t to_date(int32_t rata_die) {
+    auto const [y, m, d] = civil_from_days(rata_die);
+    return { y, m, d };
+  }
+
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+    return days_from_civil(year, month, day);
+  }
+
+private:
+
+  // https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+  template <class Int>
+  static constexpr
+  std::tuple<Int, unsigned, unsigned>
+  civil_from_days(Int z) noexcept
+  {
+    z += 719468;
+    const Int era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);          // [0, 146096]
+    const unsigned yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;  // [0, 399]
+    const Int y = static_cast<Int>(yoe) + era * 400;
+    const unsigned doy = doe - (365*yoe + yoe/4 - yoe/100);                // [0, 365]
+    const unsigned mp = (5*doy + 2)/153;                                   // [0, 11]
+    const unsigned d = doy - (153*mp+2)/5 + 1;                             // [1, 31]
+    const unsigned m = mp < 10 ? mp+3 : mp-9;                              // [1, 12]
+    return std::tuple<Int, unsigned, unsigned>(y + (m <= 2), m, d);
+  }
+
+  // https://howardhinnant.github.io/date_algorithms.html#days_from_civil
+  template <class Int>
+  static constexpr
+  Int
+  days_from_civil(Int y, unsigned m, unsigned d) noexcept
+  {
+    y -= m <= 2;
+    const Int era = (y >= 0 ? y : y-399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);      // [0, 399]
+    const unsigned doy = (153*(m > 2 ? m-3 : m+9) + 2)/5 + d-1;  // [0, 365]
+    const unsigned doe = yoe * 365 + yoe/4 - yoe/100 + doy;         // [0, 146096]
+    return era * 146097 + static_cast<Int>(doe) - 719468;
+  }
+
+}; // struct hinnant
+
+#endif // EAF_ALGORITHMS_HINNANT_HPP
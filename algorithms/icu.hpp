@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Unicode-3.0
+// SPDX-SnippetCopyrightText: Copyright (C) 2016 and later: Unicode, Inc. and others.
+
+/**
+ * @file icu.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from ICU [1]
+ * (icu4c/source/i18n/gregoimp.cpp).
+ *
+ * Grego::dayToFields also computes the day of the week and the day of the
+ * year, which to_date drops as the compiler would.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://icu.unicode.org
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_ICU_HPP
+#define EAF_ALGORITHMS_ICU_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct icu {
+
+  // Original epoch: 1 January 1970.
+
+  // https://github.com/unicode-org/icu/blob/main/icu4c/source/i18n/gregoimp.cpp
+  // (Grego::dayToFields)
+  static inline
+  date32_t to_date(int32_t day) {
+
+    int32_t year;
+    int8_t month, dom;
+    int32_t doy;
+
+    // Convert from 1970 CE epoch to 1 CE epoch (Gregorian calendar)
+    day += JULIAN_1970_CE - JULIAN_1_CE;
+
+    // Convert from the day number to the multiple radix
+    // representation.  We use 400-year, 100-year, and 4-year cycles.
+    // For example, the 4-year cycle has 4 years + 1 leap day; giving
+    // 1461 == 365*4 + 1 days.
+    int32_t n400 = floorDivide(day, 146097, &doy); // 400-year cycle length
+    int32_t n100 = floorDivide(doy, 36524, &doy); // 100-year cycle length
+    int32_t n4   = floorDivide(doy, 1461, &doy); // 4-year cycle length
+    int32_t n1   = floorDivide(doy, 365, &doy);
+    year = 400*n400 + 100*n100 + 4*n4 + n1;
+    if (n100 == 4 || n1 == 4) {
+      doy = 365; // Dec 31 at end of 4- or 400-year cycle
+    } else {
+      ++year;
+    }
+
+    bool isLeap = isLeapYear(year);
+
+    // Common Julian/Gregorian calculation
+    int32_t correction = 0;
+    int32_t march1 = isLeap ? 60 : 59; // zero-based DOY for March 1
+    if (doy >= march1) {
+      correction = isLeap ? 1 : 2;
+    }
+    month = (12 * (doy + correction) + 6) / 367; // zero-based month
+    dom = doy - DAYS_BEFORE[month + (isLeap ? 12 : 0)] + 1; // one-based DOM
+
+    return { year, uint32_t(month + 1), uint32_t(dom) };
+  }
+
+  // https://github.com/unicode-org/icu/blob/main/icu4c/source/i18n/gregoimp.cpp
+  // (Grego::fieldsToDay)
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t m, uint32_t dom) {
+
+    int32_t month = int32_t(m) - 1; // zero-based in ICU
+    int32_t y = year - 1;
+    int64_t julian = 365LL * y + floorDivide(y, 4) + (JULIAN_1_CE - 3) + // Julian cal
+      floorDivide(y, 400) - floorDivide(y, 100) + 2 + // => Gregorian cal
+      DAYS_BEFORE[month + (isLeapYear(year) ? 12 : 0)] + dom; // => month/dom
+    return int32_t(julian - JULIAN_1970_CE); // JD => epoch day
+  }
+
+private:
+
+  // https://github.com/unicode-org/icu/blob/main/icu4c/source/i18n/gregoimp.h
+  static int32_t constexpr JULIAN_1_CE    = 1721426; // January 1, 1 CE Gregorian
+  static int32_t constexpr JULIAN_1970_CE = 2440588; // January 1, 1970 CE Gregorian
+
+  static inline
+  bool isLeapYear(int32_t year) {
+    // year&0x3 == year%4
+    return ((year&0x3) == 0) && ((year%100 != 0) || (year%400 == 0));
+  }
+
+  // https://github.com/unicode-org/icu/blob/main/icu4c/source/i18n/gregoimp.cpp
+  static int16_t constexpr DAYS_BEFORE[24] =
+    {0,31,59,90,120,151,181,212,243,273,304,334,
+     0,31,60,91,121,152,182,213,244,274,305,335};
+
+  // https://github.com/unicode-org/icu/blob/main/icu4c/source/i18n/gregoimp.cpp
+  // (ClockMath::floorDivide)
+  static inline
+  int32_t floorDivide(int32_t numerator, int32_t denominator) {
+    return (numerator >= 0) ?
+      numerator / denominator : ((numerator + 1) / denominator) - 1;
+  }
+
+  static inline
+  int32_t floorDivide(int32_t numerator, int32_t denominator,
+    int32_t* remainder) {
+    int32_t quotient = floorDivide(numerator, denominator);
+    if (remainder != nullptr) {
+      *remainder = numerator - (quotient * denominator);
+    }
+    return quotient;
+  }
+
+}; // struct icu
+
+#endif // EAF_ALGORITHMS_ICU_HPP
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/safe-date
+
+#ifndef EAF_ALGORITHMS_JULIAN_FAST32_H
+#define EAF_ALGORITHMS_JULIAN_FAST32_H
+
+#include "eaf/date.hpp"
+#include "eaf/bounds.hpp"
+
+#include <stdint.h>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define IS_ARM 1
+#else
+#define IS_ARM 0
+#endif
+
+template <typename BOUNDS = eaf::bounds::unchecked>
+struct julian_fast32_t {
+
+  // benjoffe_fast32_wide applied to the proleptic Julian calendar.
+  // Supports full signed 32-bit input range, using only 32-bit arithmetic.
+  // The input is the same day number as all other algorithms, i.e., days
+  // since 1 January 1970 of the Gregorian calendar, which is 19 December
+  // 1969 of the Julian calendar.
+  //
+  // Bucket technique explained in:
+  // [2] https://www.benjoffe.com/safe-date
+  //
+  // Backwards-counting technique explained in:
+  // [3] https://www.benjoffe.com/fast-date-64
+
+  // Buckets of 2^17 days are re-based by 90 four-year cycles, so the
+  // reverse day count only drifts by 418 days per bucket, keeping it well
+  // within the range where C2 is exact.
+  static uint32_t constexpr BUCK_Y = 360;
+  static uint32_t constexpr BUCK_D = 131490;
+
+  // Reference point of bucket 0 is the last day of February of Julian year
+  // -5877160 (a multiple of 4) which is day 131487 - 2^31.
+  static uint32_t constexpr D_SHIFT = 131487;
+  static uint32_t constexpr Y_SHIFT = 5877161;
+
+  static uint32_t constexpr C2 = 3010298776; // ceil(2^40*4/1461)
+  static uint32_t constexpr C3 = 2006057;    // ceil(2^32/2141)
+
+  // Shift constants for to_rata_die, see julian_fast64.
+  static uint32_t constexpr R_CYCLES = 1470000;
+  static uint32_t constexpr R_SHIFT = 1461 * R_CYCLES + 719471;
+
+  int32_t static constexpr rata_die_min = INT32_MIN;
+  int32_t static constexpr rata_die_max = INT32_MAX;
+
+  // Julian dates whose rata dies are in the range above:
+  static date32_t constexpr date_min = { -5877520,  3, 3 };
+  static date32_t constexpr date_max = {  5881459, 10, 5 };
+
+  static inline
+  date32_t to_date(int32_t dayNumber) {
+
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
+
+    uint32_t const d0 = dayNumber + 2147483648;
+
+    uint32_t const bucket = d0 >> 17;
+
+    // 1. Reverse day count using the bucket technique.
+    uint32_t const rev = bucket * BUCK_D - d0 + D_SHIFT;
+
+    // 2. Determine year and day-of-year using an EAF numerator.
+    // Mul-shift to divide by 365.25:
+    uint32_t const yrs = rev * uint64_t(C2) >> 40;
+    uint32_t const rem = rev - yrs * 1461 / 4;
+
+  #if IS_ARM
+    uint32_t const shift = 979360;
+  #else
+    // Jan/Feb cutoff when counting backwards:
+    uint32_t const bump = rem <= 59;
+    uint32_t const shift = bump ? 192928 : 979360;
+  #endif
+
+    // Neri-Schneider technique for Day and Month, see benjoffe_fast32.
+    uint32_t const N = shift - rem * 2141;
+    uint32_t const M = N / 65536;
+    uint32_t const D = ((N % 65536) * uint64_t(C3)) >> 32;
+
+  #if IS_ARM
+    uint32_t const bump = M > 12;
+    uint32_t const month = bump ? M - 12 : M;
+  #else
+    uint32_t const month = M;
+  #endif
+
+    uint32_t const day = D + 1;
+    int32_t const year = BUCK_Y*bucket - Y_SHIFT - yrs + bump;
+
+    return { year, month, day };
+  }
+
+  // The below is identical to julian_fast64.hpp
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    date32_t const date = BOUNDS::check(date32_t{ year, month, day },
+      date_min, date_max);
+    year  = date.year;
+    month = date.month;
+    day   = date.day;
+
+    uint32_t const bump = month <= 2;
+    uint32_t const yrs = uint32_t(year + int32_t(4 * R_CYCLES)) - bump;
+    int32_t const shift = bump ? 8829 : -2919;
+
+    uint32_t const year_days = yrs * 365 + yrs / 4;
+    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
+
+    return year_days + month_days + day - R_SHIFT;
+  }
+
+}; // struct julian_fast32_t
+
+using julian_fast32 = julian_fast32_t<>;
+
+#undef IS_ARM
+
+#endif // EAF_ALGORITHMS_JULIAN_FAST32_H
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_ALGORITHMS_JULIAN_FAST64_H
+#define EAF_ALGORITHMS_JULIAN_FAST64_H
+
+#include "eaf/date.hpp"
+#include "eaf/bounds.hpp"
+#include "algorithms/_portable_uint128.hpp"
+
+#include <stdint.h>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define IS_ARM 1
+#else
+#define IS_ARM 0
+#endif
+
+template <typename BOUNDS = eaf::bounds::unchecked>
+struct julian_fast64_t {
+
+  // benjoffe_fast64 applied to the proleptic Julian calendar.
+  // The input is the same day number as all other algorithms, i.e., days
+  // since 1 January 1970 of the Gregorian calendar, which is 19 December
+  // 1969 of the Julian calendar.
+  //
+  // Without the 100/400 rule there is no century step (the "Julian map" is
+  // the identity) so the reverse day count directly feeds the 365.25
+  // mul-shift.
+
+  // Shift constants for working with positive numbers.
+  // Reference point is the last day of February of year 4 * CYCLES, which
+  // is 1461 * CYCLES - 719471. The smallest CYCLES that keeps rev
+  // non-negative for INT32_MAX supports full signed 32-bit input range.
+  static uint64_t constexpr CYCLES = 1470365;
+  static uint64_t constexpr D_SHIFT = 1461 * CYCLES - 719471;
+  static uint32_t constexpr Y_SHIFT = 4 * CYCLES - 1;
+
+#if IS_ARM
+  // ARM benefits from smaller constants
+  static uint32_t constexpr SCALE = 1;
+#else
+  static uint32_t constexpr SCALE = 32;
+#endif
+
+  static uint32_t constexpr SHIFT_0 = 30556 * SCALE;
+  static uint32_t constexpr SHIFT_1 = 5980 * SCALE;
+
+  static uint64_t constexpr C2 = 50504432782230121ull; // ceil(2^64*4/1461):
+  static uint64_t constexpr C3 = 8619973866219416ull * 32 / SCALE; // floor(2^64/2140):
+
+  // Shift constants for to_rata_die: years are shifted by 4 * R_CYCLES to
+  // be non-negative over the output range, and R_SHIFT is the number of
+  // days from the last day of February of year -4 * R_CYCLES to 1 January
+  // 1970.
+  static uint32_t constexpr R_CYCLES = 1470000;
+  static uint32_t constexpr R_SHIFT = 1461 * R_CYCLES + 719471;
+
+  /**
+   * Supports full 32-bit input range.
+   */
+  int32_t static constexpr rata_die_min = INT32_MIN;
+  int32_t static constexpr rata_die_max = INT32_MAX;
+
+  // Julian dates whose rata dies are in the range above:
+  static date32_t constexpr date_min = { -5877520,  3, 3 };
+  static date32_t constexpr date_max = {  5881459, 10, 5 };
+
+  static inline
+  date32_t to_date(int32_t dayNumber) {
+
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
+
+    // 1. Reverse day count:
+    uint64_t const rev = D_SHIFT - int64_t(dayNumber);
+
+    // 2. Determine year and year-part using an EAF numerator.
+    // Mul-shift to divide by 365.25:
+    uint128_t const num = uint128_t(C2) * rev;
+    uint32_t const yrs = Y_SHIFT - uint32_t(num >> 64); // Forward year
+    uint64_t const low = uint64_t(num);                 // Remainder
+
+    // Year-part, see benjoffe_fast64:
+    uint32_t const ypt = uint32_t(uint128_t(24451 * SCALE) * low >> 64);
+
+  #if IS_ARM
+    // Perform bump later for faster code on Apple Silicon.
+    uint32_t const shift = SHIFT_0;
+  #else
+    uint32_t const bump = ypt < (3952 * SCALE);      // Jan or Feb
+    uint32_t const shift = bump ? SHIFT_1 : SHIFT_0; // Shift offset
+  #endif
+
+    // 3. Year-modulo-bitshift for leap years,
+    // also revert to forward direction.
+    uint32_t const N = (yrs % 4) * (16 * SCALE) + shift - ypt;
+    uint32_t const M = N / (2048 * SCALE);
+    uint32_t const D = uint32_t(uint128_t(C3) * (N % (2048 * SCALE)) >> 64);
+
+  #if IS_ARM
+    uint32_t const bump = M > 12;             // Jan or Feb:
+    uint32_t const month = bump ? M - 12 : M; // Single-cycle on ARM:
+  #else
+    uint32_t const month = M; // Already correct due to prior shift
+  #endif
+
+    // Normalize from 0-index to 1-index Day:
+    uint32_t const day = D + 1;
+    // Overflow year when Jan or Feb:
+    int32_t const year = yrs + bump;
+
+    return date32_t{year, month, day};
+  }
+
+  // Overflow-safe inverse function.
+  // Accurate over the full signed 32-bit output range.
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    date32_t const date = BOUNDS::check(date32_t{ year, month, day },
+      date_min, date_max);
+    year  = date.year;
+    month = date.month;
+    day   = date.day;
+
+    uint32_t const bump = month <= 2;
+    uint32_t const yrs = uint32_t(year + int32_t(4 * R_CYCLES)) - bump;
+    int32_t const shift = bump ? 8829 : -2919;
+
+    // As benjoffe_fast64 without the century terms:
+    uint32_t const year_days = yrs * 365 + yrs / 4;
+    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
+
+    return year_days + month_days + day - R_SHIFT;
+  }
+
+}; // struct julian_fast64_t
+
+using julian_fast64 = julian_fast64_t<>;
+
+#undef IS_ARM
+
+#endif // EAF_ALGORITHMS_JULIAN_FAST64_H
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_ALGORITHMS_JULIAN_GREGORIAN_H
+#define EAF_ALGORITHMS_JULIAN_GREGORIAN_H
+
+#include "eaf/date.hpp"
+#include "eaf/variant.hpp"
+#include "algorithms/_portable_uint128.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/julian_fast64.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename VARIANT = eaf::variant::native>
+struct julian_gregorian_t {
+
+  // Historical dates: the Julian calendar up to a reform, and the
+  // Gregorian calendar from the reform onwards. The reform is given at
+  // runtime as the rata die (days since 1 January 1970) of the first
+  // Gregorian day, e.g., one of the constants below.
+  //
+  // The fast Gregorian and Julian algorithms only differ in the century
+  // terms and shift constants, so both calendars are handled by a single
+  // evaluation where the calendar is picked with selects, leaving no
+  // data-dependent branch. VARIANT picks the x86 or ARM code path, as in
+  // benjoffe_fast64 (see eaf/variant.hpp).
+
+  // 15 October 1582 (Gregorian), which followed 4 October 1582 (Julian).
+  static int32_t constexpr rome = -141427;
+  // 14 September 1752 (Gregorian), which followed 2 September 1752 (Julian).
+  static int32_t constexpr britain = -79366;
+
+  /**
+   * Finds the historical date from its rata die.
+   */
+  static inline
+  date32_t to_date(int32_t rata_die, int32_t changeover) {
+
+    // All-ones on the Gregorian calendar. Selects are written as masks
+    // since compilers otherwise tend to turn them into a branch.
+    uint64_t const greg = -uint64_t(rata_die >= changeover);
+
+    // 1. Reverse day count, see benjoffe_fast64 and julian_fast64.
+    uint64_t const d_shift = J::D_SHIFT + (greg & (G::D_SHIFT - J::D_SHIFT));
+    uint64_t const rev = d_shift - int64_t(rata_die);
+    // Adjust for 100/400 leap year rule on the Gregorian calendar only:
+    uint64_t const cen = uint128_t(G::C1) * rev >> 64;
+    uint64_t const jul = rev + (greg & (cen - cen / 4));
+
+    // 2. Determine year and year-part using an EAF numerator.
+    uint32_t const y_shift = J::Y_SHIFT + (greg & (G::Y_SHIFT - J::Y_SHIFT));
+    uint128_t const num = uint128_t(G::C2) * jul;
+    uint32_t const yrs = y_shift - uint32_t(num >> 64);
+    uint64_t const low = uint64_t(num);
+    uint32_t const ypt = uint32_t(uint128_t(24451 * G::SCALE) * low >> 64);
+
+    uint32_t const early = ypt < (3952 * G::SCALE);
+    uint32_t const shift = !VARIANT::late_bump && early ? G::SHIFT_1 :
+      G::SHIFT_0;
+
+    // 3. Year-modulo-bitshift for leap years.
+    uint32_t const N = (yrs % 4) * (16 * G::SCALE) + shift - ypt;
+    uint32_t const M = N / (2048 * G::SCALE);
+    uint32_t const D = uint32_t(uint128_t(G::C3) * (N % (2048 * G::SCALE)) >> 64);
+
+    // Late bump on ARM, see benjoffe_fast64:
+    uint32_t const late = M > 12;
+    uint32_t const bump = VARIANT::late_bump ? late : early;
+    uint32_t const month = VARIANT::late_bump && late ? M - 12 : M;
+
+    return { int32_t(yrs + bump), month, D + 1 };
+  }
+
+  /**
+   * Calculates the rata die of a historical date.
+   *
+   * A date is taken as Julian if, read as such, it falls before the
+   * changeover. Dates skipped by the reform (e.g., 5 to 14 October 1582 in
+   * Rome) are therefore read as proleptic Gregorian.
+   */
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day,
+    int32_t changeover) {
+
+    uint32_t const bump = month <= 2;
+    uint32_t const yrs = uint32_t(year + int32_t(400 * G::R_ERAS)) - bump;
+    uint32_t const cen = yrs / 100;
+    int32_t const shift = bump ? 8829 : -2919;
+
+    // See julian_fast64 and benjoffe_fast64:
+    uint32_t const month_days = (979 * int32_t(month) + shift) / 32;
+    uint32_t const days = yrs * 365 + yrs / 4 + month_days + day;
+    int32_t const julian = days - R_SHIFT_J;
+    uint32_t const greg = -uint32_t(julian >= changeover);
+
+    // Gregorian: days - cen + cen / 4 - G::R_SHIFT.
+    return julian + (greg & (cen / 4 - cen + (R_SHIFT_J - G::R_SHIFT)));
+  }
+
+  // Batch forms of the above.
+
+  static inline
+  void to_date(int32_t const* rata_dies, date32_t* dates, size_t count,
+    int32_t changeover) {
+    for (size_t i = 0; i < count; ++i)
+      dates[i] = to_date(rata_dies[i], changeover);
+  }
+
+  static inline
+  void to_rata_die(date32_t const* dates, int32_t* rata_dies, size_t count,
+    int32_t changeover) {
+    for (size_t i = 0; i < count; ++i)
+      rata_dies[i] = to_rata_die(dates[i].year, dates[i].month, dates[i].day,
+        changeover);
+  }
+
+  /**
+   * Converts historical dates to the proleptic Gregorian calendar.
+   */
+  static inline
+  void to_gregorian(date32_t const* historical, date32_t* gregorian,
+    size_t count, int32_t changeover) {
+    for (size_t i = 0; i < count; ++i) {
+      date32_t const date = historical[i];
+      gregorian[i] = G::to_date(to_rata_die(date.year, date.month, date.day,
+        changeover));
+    }
+  }
+
+  /**
+   * Converts proleptic Gregorian dates to historical dates.
+   */
+  static inline
+  void to_historical(date32_t const* gregorian, date32_t* historical,
+    size_t count, int32_t changeover) {
+    for (size_t i = 0; i < count; ++i) {
+      date32_t const date = gregorian[i];
+      historical[i] = to_date(G::to_rata_die(date.year, date.month,
+        date.day), changeover);
+    }
+  }
+
+private:
+
+  using G = benjoffe_fast64_t<epoch::unix_time, eaf::bounds::unchecked,
+    VARIANT>;
+  using J = julian_fast64;
+
+  // Years of both calendars are shifted as benjoffe_fast64's, a whole
+  // number of 4-year cycles fewer than julian_fast64's, which changes its
+  // R_SHIFT by as many 1461 days:
+  static uint32_t constexpr R_SHIFT_J = J::R_SHIFT -
+    1461 * (J::R_CYCLES - 100 * G::R_ERAS);
+
+}; // struct julian_gregorian_t
+
+using julian_gregorian     = julian_gregorian_t<>;
+using julian_gregorian_x86 = julian_gregorian_t<eaf::variant::x86>;
+using julian_gregorian_arm = julian_gregorian_t<eaf::variant::arm>;
+
+#endif // EAF_ALGORITHMS_JULIAN_GREGORIAN_H
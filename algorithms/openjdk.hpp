@@ -81,6 +81,7 @@
 #define EAF_ALGORITHMS_OPENJDK_HPP
 
 #include "eaf/date.hpp"
+#include "eaf/slow_paths.hpp"
 
 #include <cstdint>
 
@@ -105,6 +106,7 @@ struct openjdk {
     long yearEst = (400 * zeroDay + 591) / DAYS_PER_CYCLE;
     long doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
     if (doyEst < 0) {
+        EAF_SLOW_PATH(openjdk_doy_fix);
         // fix estimate
         yearEst--;
         doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
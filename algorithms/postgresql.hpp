@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: PostgreSQL
+// SPDX-SnippetCopyrightText: Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
+
+/**
+ * @file postgresql.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from PostgreSQL [1].
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://www.postgresql.org
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_POSTGRESQL_HPP
+#define EAF_ALGORITHMS_POSTGRESQL_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct postgresql {
+
+  // Original epoch: Julian day 0 (24 November 4714 BC). PostgreSQL stores
+  // dates as days since 1 January 2000, and converts them to Julian days
+  // (adding POSTGRES_EPOCH_JDATE) before calling j2date.
+  static constexpr int32_t ajustment = 2440588;
+
+  // https://github.com/postgres/postgres/blob/master/src/backend/utils/adt/datetime.c
+  static inline
+  date32_t to_date(int32_t rata_die) {
+
+    int jd = rata_die + ajustment;
+
+    unsigned int julian;
+    unsigned int quad;
+    unsigned int extra;
+    int          y;
+
+    julian = jd;
+    julian += 32044;
+    quad = julian / 146097;
+    extra = (julian - quad * 146097) * 4 + 3;
+    julian += 60 + quad * 3 + extra / 146097;
+    quad = julian / 1461;
+    julian -= quad * 1461;
+    y = julian * 4 / 1461;
+    julian = ((y != 0) ? ((julian + 305) % 365) : ((julian + 306) % 366))
+      + 123;
+    y += quad * 4;
+    int year = y - 4800;
+    quad = julian * 2141 / 65536;
+    int day = julian - 7834 * quad / 256;
+    int month = (quad + 10) % MONTHS_PER_YEAR + 1;
+
+    return { int32_t(year), uint32_t(month), uint32_t(day) };
+  }
+
+  // https://github.com/postgres/postgres/blob/master/src/backend/utils/adt/datetime.c
+  static inline
+  int32_t to_rata_die(int32_t y, uint32_t m, uint32_t d) {
+
+    int year  = y;
+    int month = m;
+    int day   = d;
+
+    int julian;
+    int century;
+
+    if (month > 2)
+    {
+      month += 1;
+      year += 4800;
+    }
+    else
+    {
+      month += 13;
+      year += 4799;
+    }
+
+    century = year / 100;
+    julian = year * 365 - 32167;
+    julian += year / 4 - century + century / 4;
+    julian += 7834 * month / 256 + day;
+
+    return julian - ajustment;
+  }
+
+private:
+
+  // https://github.com/postgres/postgres/blob/master/src/include/datatype/timestamp.h
+  static int constexpr MONTHS_PER_YEAR = 12;
+
+}; // struct postgresql
+
+#endif // EAF_ALGORITHMS_POSTGRESQL_HPP
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT OR Apache-2.0
+// SPDX-SnippetCopyrightText: Copyright (c) 2014, Kang Seonghoon and contributors.
+
+/**
+ * @file rust_chrono.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from Rust's chrono crate [1]
+ * (src/naive/date.rs and src/naive/internals.rs).
+ *
+ * NaiveDate keeps the year, the ordinal day and the year flags (Of) and
+ * derives month and day through the OL_TO_MDL table. chrono's tables are
+ * literals, generated here at compile time, and the Option checks of
+ * out-of-range and invalid dates are omitted.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://github.com/chronotope/chrono
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_RUST_CHRONO_HPP
+#define EAF_ALGORITHMS_RUST_CHRONO_HPP
+
+#include "eaf/date.hpp"
+
+#include <array>
+#include <cstdint>
+
+struct rust_chrono {
+
+  // Original epoch: 1 January 1 is day 1 (num_days_from_ce).
+  static constexpr int32_t ajustment = 719163;
+
+  // https://github.com/chronotope/chrono/blob/v0.4.31/src/naive/date.rs
+  // (from_num_days_from_ce_opt, month and day)
+  static inline
+  date32_t to_date(int32_t rata_die) {
+
+    int32_t days = rata_die + ajustment;
+    days = days + 365; // make December 31, 1 BCE equal to day 0
+    int32_t year_div_400 = div_euclid(days, 146'097);
+    uint32_t cycle = uint32_t(rem_euclid(days, 146'097));
+    auto [year_mod_400, ordinal] = cycle_to_yo(cycle);
+    uint32_t flags = YEAR_TO_FLAGS[year_mod_400];
+    int32_t year = year_div_400 * 400 + int32_t(year_mod_400);
+
+    // Of::new, Of::to_mdf and Mdf::from_of.
+    uint32_t of = (ordinal << 4) | flags;
+    uint32_t ol = of >> 3;
+    uint32_t mdf = of + (uint32_t(OL_TO_MDL[ol]) << 3);
+
+    return { year, mdf >> 9, (mdf >> 4) & 0b1'1111 };
+  }
+
+  // https://github.com/chronotope/chrono/blob/v0.4.31/src/naive/date.rs
+  // (from_ymd_opt and num_days_from_ce)
+  static inline
+  int32_t to_rata_die(int32_t y, uint32_t month, uint32_t day) {
+
+    // YearFlags::from_year, Mdf::new and Mdf::to_of.
+    uint32_t flags = YEAR_TO_FLAGS[rem_euclid(y, 400)];
+    uint32_t mdf = (month << 9) | (day << 4) | flags;
+    uint32_t mdl = mdf >> 3;
+    uint32_t of = mdf - ((uint32_t(int32_t(MDL_TO_OL[mdl])) & 0x3ff) << 3);
+
+    int32_t year = y - 1;
+    int32_t ndays = 0;
+    if (year < 0) {
+      int32_t excess = 1 + (-year) / 400;
+      year += excess * 400;
+      ndays -= excess * 146'097;
+    }
+    int32_t div_100 = year / 100;
+    ndays += ((year * 1461) >> 2) - div_100 + (div_100 >> 2);
+    ndays += int32_t(of >> 4);
+
+    return ndays - ajustment;
+  }
+
+private:
+
+  static constexpr
+  int32_t div_euclid(int32_t a, int32_t b) {
+    int32_t const q = a / b;
+    return a % b < 0 ? q - 1 : q;
+  }
+
+  static constexpr
+  int32_t rem_euclid(int32_t a, int32_t b) {
+    int32_t const r = a % b;
+    return r < 0 ? r + b : r;
+  }
+
+  // Leap days before year i of the 400-year cycle (year 0 is leap).
+  static constexpr std::array<uint8_t, 401> YEAR_DELTAS = [](){
+    std::array<uint8_t, 401> deltas{};
+    for (int32_t i = 0; i <= 400; ++i)
+      deltas[i] = uint8_t((i + 3) / 4 - (i + 99) / 100 + (i + 399) / 400);
+    return deltas;
+  }();
+
+  // https://github.com/chronotope/chrono/blob/v0.4.31/src/naive/internals.rs
+  // The year flags (aka the dominical letter): 0b1000 for common years, and
+  // the weekday of the last day of the past year, Tuesday = 1 to Monday = 7.
+  static constexpr std::array<uint8_t, 400> YEAR_TO_FLAGS = [](){
+    std::array<uint8_t, 400> flags{};
+    // 31 December 1999 is a Friday.
+    int32_t weekday = 4;
+    for (int32_t i = 0; i < 400; ++i) {
+      bool const leap = i % 4 == 0 && (i % 100 != 0 || i == 0);
+      flags[i] = uint8_t((leap ? 0 : 0b1000) | weekday);
+      weekday = (weekday + (leap ? 366 : 365) - 1) % 7 + 1;
+    }
+    return flags;
+  }();
+
+  // Month, day and leap bit (mdl) minus ordinal and leap bit (ol). The
+  // entries of invalid ol or mdl are 0 (XX in chrono).
+  static constexpr std::array<uint8_t, 733 + 1> OL_TO_MDL = [](){
+    std::array<uint8_t, 733 + 1> table{};
+    for (uint32_t common = 0; common < 2; ++common) {
+      uint32_t ordinal = 1;
+      for (uint32_t month = 1; month <= 12; ++month) {
+        uint32_t const days = month == 2 ? 29 - common :
+          30 + ((month + month / 8) & 1);
+        for (uint32_t day = 1; day <= days; ++day, ++ordinal) {
+          uint32_t const ol  = (ordinal << 1) | common;
+          uint32_t const mdl = (month << 6) | (day << 1) | common;
+          table[ol] = uint8_t(mdl - ol);
+        }
+      }
+    }
+    return table;
+  }();
+
+  static constexpr std::array<int8_t, (12 << 6 | 31 << 1 | 1) + 1>
+  MDL_TO_OL = [](){
+    std::array<int8_t, (12 << 6 | 31 << 1 | 1) + 1> table{};
+    for (uint32_t ol = 2; ol < OL_TO_MDL.size(); ++ol)
+      if (OL_TO_MDL[ol] != 0)
+        table[ol + OL_TO_MDL[ol]] = int8_t(OL_TO_MDL[ol]);
+    return table;
+  }();
+
+  // https://github.com/chronotope/chrono/blob/v0.4.31/src/naive/internals.rs
+  struct yo_t {
+    uint32_t year_mod_400;
+    uint32_t ordinal;
+  };
+
+  static inline
+  yo_t cycle_to_yo(uint32_t cycle) {
+    uint32_t year_mod_400 = cycle / 365;
+    uint32_t ordinal0 = cycle % 365;
+    uint32_t delta = uint32_t(YEAR_DELTAS[year_mod_400]);
+    if (ordinal0 < delta) {
+      year_mod_400 -= 1;
+      ordinal0 += 365 - uint32_t(YEAR_DELTAS[year_mod_400]);
+    } else {
+      ordinal0 -= delta;
+    }
+    return { year_mod_400, ordinal0 + 1 };
+  }
+
+}; // struct rust_chrono
+
+#endif // EAF_ALGORITHMS_RUST_CHRONO_HPP
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: blessing
+// SPDX-SnippetCopyrightText: The author disclaims copyright to this source code.
+
+/**
+ * @file sqlite.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from SQLite [1].
+ *
+ * SQLite keeps a date-time as its Julian day times 86400000 (iJD) and
+ * converts between whole days and milliseconds around the calendar
+ * arithmetic. Below, that scaling is removed and iJD is a whole Julian day
+ * (Z in computeYMD). The floating point arithmetic of computeYMD is kept.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://www.sqlite.org
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_SQLITE_HPP
+#define EAF_ALGORITHMS_SQLITE_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct sqlite {
+
+  // Original epoch: Julian day 0 (24 November 4714 BC).
+  static constexpr int32_t ajustment = 2440588;
+
+  // https://github.com/sqlite/sqlite/blob/master/src/date.c (computeYMD)
+  static inline
+  date32_t to_date(int32_t rata_die) {
+
+    int Z, A, B, C, D, E, X1;
+    Z = rata_die + ajustment;
+    A = (int)((Z - 1867216.25)/36524.25);
+    A = Z + 1 + A - (A/4);
+    B = A + 1524;
+    C = (int)((B - 122.1)/365.25);
+    D = (36525*(C&32767))/100;
+    E = (int)((B-D)/30.6001);
+    X1 = (int)(30.6001*E);
+    int day = B - D - X1;
+    int month = E<14 ? E-1 : E-13;
+    int year = month>2 ? C - 4716 : C - 4715;
+
+    return { int32_t(year), uint32_t(month), uint32_t(day) };
+  }
+
+  // https://github.com/sqlite/sqlite/blob/master/src/date.c (computeJD)
+  static inline
+  int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day) {
+
+    int Y, M, D, A, B, X1, X2;
+    Y = year;
+    M = month;
+    D = day;
+    if( M<=2 ){
+      Y--;
+      M += 12;
+    }
+    A = (Y+4800)/100;
+    B = 38 - A + (A/4);
+    X1 = 36525*(Y+4716)/100;
+    X2 = 306001*(M+1)/10000;
+    // SQLite subtracts 1524.5, for midnight, before scaling to milliseconds.
+    int iJD = X1 + X2 + D + B - 1524;
+
+    return iJD - ajustment;
+  }
+
+}; // struct sqlite
+
+#endif // EAF_ALGORITHMS_SQLITE_HPP
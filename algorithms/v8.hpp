@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// SPDX-SnippetCopyrightText: Copyright 2012 the V8 project authors. All rights reserved.
+
+/**
+ * @file v8.hpp
+ *
+ * @brief Algorithms on the Gregorian calendar from V8 [1]
+ * (src/date/date.cc).
+ *
+ * DateCache::YearMonthDayFromDays first checks whether the day is in the
+ * month of the previous call, which is cached. The cache is kept here in
+ * static members, so to_date is not thread safe. Months are 0-based in V8.
+ *
+ * This code is a supplementary material to [2].
+ *
+ *     [1] https://v8.dev
+ *
+ *     [2] Neri C, and Schneider L, "Euclidean Affine Functions and their
+ *     Application to Calendar Algorithms" (2022).
+ */
+
+#ifndef EAF_ALGORITHMS_V8_HPP
+#define EAF_ALGORITHMS_V8_HPP
+
+#include "eaf/date.hpp"
+
+#include <cstdint>
+
+struct v8 {
+
+  // Original epoch: 1 January 1970.
+
+  // https://github.com/v8/v8/blob/main/src/date/date.cc
+  // (DateCache::YearMonthDayFromDays)
+  static inline
+  date32_t to_date(int days) {
+
+    int year, month = 0, day = 0; // Output parameters in V8.
+
+    if (ymd_valid_) {
+      // Check conservatively if the given 'days' has
+      // the same year and month as the cached 'days'.
+      int new_day = ymd_day_ + (days - ymd_days_);
+      if (new_day >= 1 && new_day <= 28) {
+        ymd_day_ = new_day;
+        ymd_days_ = days;
+        year = ymd_year_;
+        month = ymd_month_;
+        day = new_day;
+        return { int32_t(year), uint32_t(month + 1), uint32_t(day) };
+      }
+    }
+    int save_days = days;
+
+    days += kDaysOffset;
+    year = 400 * (days / kDaysIn400Years) - kYearsOffset;
+    days %= kDaysIn400Years;
+
+    days--;
+    int yd1 = days / kDaysIn100Years;
+    days %= kDaysIn100Years;
+    year += 100 * yd1;
+
+    days++;
+    int yd2 = days / kDaysIn4Years;
+    days %= kDaysIn4Years;
+    year += 4 * yd2;
+
+    days--;
+    int yd3 = days / 365;
+    days %= 365;
+    year += yd3;
+
+    bool is_leap = (!yd1 || yd2) && !yd3;
+
+    days += is_leap;
+
+    // Check if the date is after February.
+    if (days >= 31 + 28 + int(is_leap)) {
+      days -= 31 + 28 + int(is_leap);
+      // Find the date starting from March.
+      for (int i = 2; i < 12; i++) {
+        if (days < kDaysInMonths[i]) {
+          month = i;
+          day = days + 1;
+          break;
+        }
+        days -= kDaysInMonths[i];
+      }
+    } else {
+      // Check January and February.
+      if (days < 31) {
+        month = 0;
+        day = days + 1;
+      } else {
+        month = 1;
+        day = days - 31 + 1;
+      }
+    }
+    ymd_valid_ = true;
+    ymd_year_ = year;
+    ymd_month_ = month;
+    ymd_day_ = day;
+    ymd_days_ = save_days;
+
+    return { int32_t(year), uint32_t(month + 1), uint32_t(day) };
+  }
+
+  // https://github.com/v8/v8/blob/main/src/date/date.cc
+  // (DateCache::DaysFromYearMonth)
+  static inline
+  int32_t to_rata_die(int32_t y, uint32_t m, uint32_t d) {
+    return DaysFromYearMonth(y, int(m) - 1) + int(d) - 1;
+  }
+
+private:
+
+  // https://github.com/v8/v8/blob/main/src/date/date.h
+  static int constexpr kDaysIn4Years = 4 * 365 + 1;
+  static int constexpr kDaysIn100Years = 25 * kDaysIn4Years - 1;
+  static int constexpr kDaysIn400Years = 4 * kDaysIn100Years + 1;
+  static int constexpr kDays1970to2000 = 30 * 365 + 7;
+  static int constexpr kDaysOffset =
+    1000 * kDaysIn400Years + 5 * kDaysIn400Years - kDays1970to2000;
+  static int constexpr kYearsOffset = 400000;
+
+  // https://github.com/v8/v8/blob/main/src/date/date.cc
+  static char constexpr kDaysInMonths[] = {
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+  static inline bool ymd_valid_ = false;
+  static inline int ymd_year_;
+  static inline int ymd_month_;
+  static inline int ymd_day_;
+  static inline int ymd_days_;
+
+  // https://github.com/v8/v8/blob/main/src/date/date.cc
+  static inline
+  int DaysFromYearMonth(int year, int month) {
+    static const int day_from_month[] = {0,   31,  59,  90,  120, 151,
+                                         181, 212, 243, 273, 304, 334};
+    static const int day_from_month_leap[] = {0,   31,  60,  91,  121, 152,
+                                              182, 213, 244, 274, 305, 335};
+
+    year += month / 12;
+    month %= 12;
+    if (month < 0) {
+      year--;
+      month += 12;
+    }
+
+    // year_delta is an arbitrary number such that:
+    // a) year_delta = -1 (mod 400)
+    // b) year + year_delta > 0 for years in the range defined by
+    //    ECMA 262 - 15.9.1.1, i.e. upto 100,000,000 days on either side of
+    //    Jan 1 1970. This is required so that we don't run into integer
+    //    division of negative numbers.
+    // c) there shouldn't be an overflow for 32-bit integers in the following
+    //    operations.
+    static const int year_delta = 399999;
+    static const int base_day =
+        365 * (1970 + year_delta) + (1970 + year_delta) / 4 -
+        (1970 + year_delta) / 100 + (1970 + year_delta) / 400;
+
+    int year1 = year + year_delta;
+    int day_from_year =
+        365 * year1 + year1 / 4 - year1 / 100 + year1 / 400 - base_day;
+
+    if ((year % 4 != 0) || (year % 100 == 0 && year % 400 != 0)) {
+      return day_from_year + day_from_month[month];
+    }
+    return day_from_year + day_from_month_leap[month];
+  }
+
+}; // struct v8
+
+#endif // EAF_ALGORITHMS_V8_HPP
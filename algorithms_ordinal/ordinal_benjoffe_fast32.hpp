@@ -27,18 +27,36 @@
 #ifndef EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST32_H
 #define EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST32_H
 
+#include "eaf/bounds.hpp"
+#include "util/epoch.hpp"
 #include "util/ordinal.hpp"
 
 #include <stdint.h>
 
-struct ordinal_benjoffe_fast32 {
+template <int32_t EPOCH = epoch::unix_time,
+  typename BOUNDS = eaf::bounds::unchecked>
+struct ordinal_benjoffe_fast32_t {
+
+  // Day numbers count from EPOCH, see benjoffe_fast64.
 
   static uint32_t constexpr ERAS = 5949;
   // Rata Die shift:
-  static uint32_t constexpr D_SHIFT = 146097 * ERAS + 719162 + 366;
+  static uint32_t constexpr D_SHIFT = 146097 * ERAS + 719162 + 366 + EPOCH;
   // Year shift:
   static uint32_t constexpr Y_SHIFT = 400 * ERAS;
 
+  // Range of day below for which the result is exact (found by exhaustive
+  // search, see tests/rangetest_ordinal_fast_32.cpp.)
+  static uint32_t constexpr DAY_MIN = 366;
+  static uint32_t constexpr DAY_MAX = 1739698603;
+
+  static_assert(DAY_MIN - 146097 * int64_t(ERAS) - 719528 - EPOCH >=
+    INT32_MIN && DAY_MAX - 146097 * int64_t(ERAS) - 719528 - EPOCH <=
+    INT32_MAX, "Epoch out of range");
+
+  int32_t static constexpr rata_die_min = DAY_MIN - D_SHIFT;
+  int32_t static constexpr rata_die_max = DAY_MAX - D_SHIFT;
+
   static uint32_t constexpr CEN_MUL = uint32_t((4ull << 47) / 146097);
   static uint32_t constexpr JUL_MUL = uint32_t((4ull << 40) / 1461 + 1);
   static uint32_t constexpr CEN_CUT = uint32_t((365ull << 32) / 36525);
@@ -46,6 +64,8 @@ struct ordinal_benjoffe_fast32 {
   static inline
   ordinal32_t to_date(int32_t dayNumber) {
 
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
+
     uint32_t const day = dayNumber + D_SHIFT;           // Epoch: -XX00-01-01
     uint64_t const c_n = day * uint64_t(CEN_MUL) >> 15; // Divide 36524.25
     uint32_t const cen = uint32_t(c_n >> 32);           // Century
@@ -63,6 +83,12 @@ struct ordinal_benjoffe_fast32 {
     return ordinal32_t{year, ordinal, leap};
   }
 
-}; // struct ordinal_benjoffe_fast32
+}; // struct ordinal_benjoffe_fast32_t
+
+using ordinal_benjoffe_fast32        = ordinal_benjoffe_fast32_t<>;
+using ordinal_benjoffe_fast32_dotnet = ordinal_benjoffe_fast32_t<epoch::dotnet>;
+using ordinal_benjoffe_fast32_ole    = ordinal_benjoffe_fast32_t<epoch::ole>;
+using ordinal_benjoffe_fast32_mjd    = ordinal_benjoffe_fast32_t<epoch::mjd>;
+using ordinal_benjoffe_fast32_jdn    = ordinal_benjoffe_fast32_t<epoch::jdn>;
 
 #endif // EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST32_H
\ No newline at end of file
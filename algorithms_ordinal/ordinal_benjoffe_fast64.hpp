@@ -27,17 +27,24 @@
 #ifndef EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST64_H
 #define EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST64_H
 
+#include "eaf/bounds.hpp"
+#include "eaf/mul128.hpp"
+#include "util/epoch.hpp"
 #include "util/ordinal.hpp"
-#include "algorithms/_portable_uint128.hpp"
 
 #include <stdint.h>
 
-struct ordinal_benjoffe_fast64 {
+template <int32_t EPOCH = epoch::unix_time,
+  typename BOUNDS = eaf::bounds::unchecked,
+  typename MUL = eaf::mul128::native>
+struct ordinal_benjoffe_fast64_t {
+
+  // Day numbers count from EPOCH, see benjoffe_fast64.
 
   // Todo: tweak below for balanced range around zero:
   static uint64_t constexpr ERAS = 5000000000ull;
   // Rata Die shift:
-  static uint64_t constexpr D_SHIFT = 146097 * ERAS + 719162 + 366;
+  static uint64_t constexpr D_SHIFT = 146097 * ERAS + 719162 + 366 + EPOCH;
   // Year shift:
   static uint64_t constexpr Y_SHIFT = 400 * ERAS;
 
@@ -48,27 +55,43 @@ struct ordinal_benjoffe_fast64 {
   // floor(2^64*365/36525):
   static uint64_t constexpr CEN_CUT = 184341179655139940ull;
 
+  int32_t static constexpr rata_die_min = INT32_MIN;
+  int32_t static constexpr rata_die_max = INT32_MAX;
+
   static inline
   ordinal32_t to_date(int32_t dayNumber) {
 
+    dayNumber = BOUNDS::check(dayNumber, rata_die_min, rata_die_max);
+
     uint64_t const day = dayNumber + D_SHIFT;           // Epoch: -XX00-01-01
-    uint128_t const c_n = day * uint128_t(CEN_MUL);     // Divide 36524.25
-    uint64_t const cen = uint64_t(c_n >> 64);           // Century
-    uint64_t const cpt = uint64_t(c_n);                 // Century-part
+    uint64_t cen;                                       // Century
+    uint64_t const cpt = MUL::mul(day, CEN_MUL, &cen);  // Divide 36524.25
     bool const ijy = cen % 4 == 0 || cpt > CEN_CUT;     // "Is Julian Year"
     uint64_t const jul = day - cen / 4 + cen;           // Julian Map
-    uint128_t const y_n = jul * uint128_t(JUL_MUL);     // Divide 365.25
-    uint64_t const yrs = uint64_t(y_n >> 64);           // Year
-    uint64_t const ypt = uint64_t(y_n);                 // Year-part
+    uint64_t yrs;                                       // Year
+    uint64_t const ypt = MUL::mul(jul, JUL_MUL, &yrs);  // Divide 365.25
 
     int32_t const year = int32_t(yrs - Y_SHIFT);
-    uint32_t const ordinal = uint32_t(ypt * uint128_t(1461) >> 66) + ijy;  // Day-of-year
+    uint32_t const ordinal = uint32_t(MUL::mulh(ypt, 1461) >> 2) + ijy; // Day-of-year
     bool const leap = (yrs % 4 == 0) && ijy;
 
     return ordinal32_t{year, ordinal, leap};
   }
 
 
-}; // struct ordinal_benjoffe_fast64
+}; // struct ordinal_benjoffe_fast64_t
+
+using ordinal_benjoffe_fast64        = ordinal_benjoffe_fast64_t<>;
+using ordinal_benjoffe_fast64_dotnet = ordinal_benjoffe_fast64_t<epoch::dotnet>;
+using ordinal_benjoffe_fast64_ole    = ordinal_benjoffe_fast64_t<epoch::ole>;
+using ordinal_benjoffe_fast64_mjd    = ordinal_benjoffe_fast64_t<epoch::mjd>;
+using ordinal_benjoffe_fast64_jdn    = ordinal_benjoffe_fast64_t<epoch::jdn>;
+
+using ordinal_benjoffe_fast64_portable = ordinal_benjoffe_fast64_t<
+  epoch::unix_time, eaf::bounds::unchecked, eaf::mul128::portable>;
+#if defined(__BMI2__)
+using ordinal_benjoffe_fast64_mulx = ordinal_benjoffe_fast64_t<
+  epoch::unix_time, eaf::bounds::unchecked, eaf::mul128::mulx>;
+#endif
 
 #endif // EAF_ALGORITHMS_ORDINAL_BENJOFFE_FAST64_H
\ No newline at end of file
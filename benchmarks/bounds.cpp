@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file bounds.cpp
+ *
+ * @brief Command line program that benchmarks the cost of the bounds
+ * policies and of the batch conversions reporting out-of-range lanes.
+ */
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "eaf/bounds.hpp"
+#include "eaf/date.hpp"
+#include "eaf/gregorian.hpp"
+#include "util/epoch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+auto const rata_dies = [](){
+  // 800 years centered at 1 January 1970 (Unix epoch), as in to_date.cpp.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+// benjoffe_fast32 has the narrowest range among the benjoffe algorithms,
+// hence its checks are not optimised away.
+template <typename B>
+using fast32 = benjoffe_fast32_t<epoch::unix_time, B>;
+
+// eaf::gregorian::to_date_opt as instantiated in eaf_tests.cpp.
+template <typename B>
+struct gregorian_opt {
+  static date32_t to_date(int32_t n) {
+    return eaf::gregorian::to_date_opt<int32_t, 719468, 82, B>(n);
+  }
+};
+
+struct scan {};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (int32_t rata_die : rata_dies)
+      benchmark::DoNotOptimize(rata_die);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int32_t rata_die : rata_dies) {
+      date32_t date = A::to_date(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+}
+
+template <typename A>
+void time_batch(benchmark::State& state) {
+  std::array<date32_t, rata_dies.size()> dates;
+  for (auto _ : state) {
+    for (size_t i = 0; i < rata_dies.size(); ++i)
+      dates[i] = A::to_date(rata_dies[i]);
+    benchmark::DoNotOptimize(dates.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename A>
+void time_batch_masked(benchmark::State& state) {
+  std::array<date32_t, rata_dies.size()> dates;
+  std::array<uint64_t, rata_dies.size() / 64> out_of_range;
+  for (auto _ : state) {
+    eaf::bounds::to_date<A>(rata_dies.data(), dates.data(), rata_dies.size(),
+      out_of_range.data());
+    benchmark::DoNotOptimize(dates.data());
+    benchmark::DoNotOptimize(out_of_range.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(time<scan                              >);
+BENCHMARK(time<fast32<eaf::bounds::unchecked >   >);
+BENCHMARK(time<fast32<eaf::bounds::saturate  >   >);
+BENCHMARK(time<fast32<eaf::bounds::error_flag>   >);
+BENCHMARK(time<fast32<eaf::bounds::exception >   >);
+BENCHMARK(time<gregorian_opt<eaf::bounds::unchecked>>);
+BENCHMARK(time<gregorian_opt<eaf::bounds::saturate >>);
+BENCHMARK(time_batch       <fast32<eaf::bounds::unchecked>>);
+BENCHMARK(time_batch_masked<fast32<eaf::bounds::unchecked>>);
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file branches.cpp
+ *
+ * @brief Command line program that benchmarks to_date on the same days in
+ * different orders, to tell branches from conditional moves.
+ *
+ * Half of the days are in January or February. The orders are ascending,
+ * shuffled and alternating between January or February and the other months,
+ * which defeats a branch on the month (e.g.,
+ * the bump of benjoffe_fast64 or the J of neri_schneider_eras) but not a
+ * conditional move. Counters:
+ *
+ *   branch_misses  Per call, if hardware counters are available (see
+ *                  util/perf_counter.hpp).
+ *   loop_branches  Conditional branches of the conversion loop, as compiled
+ *                  in this program, other than its back edge, including
+ *                  those of functions it calls (see util/code_size.hpp).
+ *                  Branch-free conversions have 0.
+ */
+
+#include "algorithms/baum.hpp"
+#include "algorithms/benjoffe_article_1.hpp"
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast32_wide.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/boost.hpp"
+#include "algorithms/dotnet.hpp"
+#include "algorithms/fliegel_flandern.hpp"
+#include "algorithms/glibc.hpp"
+#include "algorithms/hatcher.hpp"
+#include "algorithms/libcxx.hpp"
+#include "algorithms/neri_schneider.hpp"
+#include "algorithms/neri_schneider_eras.hpp"
+#include "algorithms/openjdk.hpp"
+#include "algorithms/reingold_dershowitz.hpp"
+#include "eaf/date.hpp"
+#include "util/code_size.hpp"
+#include "util/perf_counter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+enum order {
+  ascending,
+  shuffled,
+  alternating, // January or February, then another month, and so on
+};
+
+std::vector<int32_t> make_days(order o) {
+
+  // As benchmarks/to_date.cpp: 800 years centered at 1 January 1970, but
+  // with as many days in January or February as in the other months, so that
+  // every order holds the same days and the alternating one can pair them.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::vector<int32_t> early, late;
+  while (early.size() < 8192 || late.size() < 8192) {
+    int32_t const n = uniform_dist(rng);
+    std::vector<int32_t>& v = neri_schneider::to_date(n).month <= 2 ?
+      early : late;
+    if (v.size() < 8192)
+      v.push_back(n);
+  }
+
+  std::vector<int32_t> ns;
+  if (o == alternating) {
+    // The month class changes on every step.
+    for (size_t i = 0; i < early.size(); ++i) {
+      ns.push_back(early[i]);
+      ns.push_back(late[i]);
+    }
+    return ns;
+  }
+
+  ns.insert(ns.end(), early.begin(), early.end());
+  ns.insert(ns.end(), late.begin(), late.end());
+  if (o == ascending)
+    std::sort(ns.begin(), ns.end());
+  else
+    std::shuffle(ns.begin(), ns.end(), rng);
+  return ns;
+}
+
+std::vector<int32_t> const days[] = {
+  make_days(ascending), make_days(shuffled), make_days(alternating),
+};
+
+// The conversion loop, out of line so that its code can be inspected.
+template <typename A>
+EAF_NOINLINE void convert(int32_t const* ns, size_t count, date32_t* dates) {
+  for (size_t i = 0; i < count; ++i)
+    dates[i] = A::to_date(ns[i]);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  std::vector<date32_t> dates(ns.size());
+
+  perf_counter misses(perf_counter::branch_misses);
+  misses.start();
+  for (auto _ : state) {
+    convert<A>(ns.data(), ns.size(), dates.data());
+    benchmark::DoNotOptimize(dates.data());
+    benchmark::ClobberMemory();
+  }
+  misses.stop();
+
+  double const calls = double(state.iterations()) * double(ns.size());
+  if (misses.valid())
+    state.counters["branch_misses"] = double(misses.read()) / calls;
+
+  code_size_t const size = code_size::measure(&convert<A>);
+  if (size.functions != 0)
+    state.counters["loop_branches"] = size.loop_branches;
+}
+
+BENCHMARK(time<neri_schneider      >)->DenseRange(ascending, alternating);
+BENCHMARK(time<neri_schneider_eras >)->DenseRange(ascending, alternating);
+BENCHMARK(time<benjoffe_fast64     >)->DenseRange(ascending, alternating);
+BENCHMARK(time<benjoffe_fast32     >)->DenseRange(ascending, alternating);
+BENCHMARK(time<benjoffe_fast32_wide>)->DenseRange(ascending, alternating);
+BENCHMARK(time<benjoffe_article_1  >)->DenseRange(ascending, alternating);
+BENCHMARK(time<baum                >)->DenseRange(ascending, alternating);
+BENCHMARK(time<boost               >)->DenseRange(ascending, alternating);
+BENCHMARK(time<dotnet              >)->DenseRange(ascending, alternating);
+BENCHMARK(time<fliegel_flandern    >)->DenseRange(ascending, alternating);
+BENCHMARK(time<glibc               >)->DenseRange(ascending, alternating);
+BENCHMARK(time<hatcher             >)->DenseRange(ascending, alternating);
+BENCHMARK(time<libcxx              >)->DenseRange(ascending, alternating);
+BENCHMARK(time<openjdk             >)->DenseRange(ascending, alternating);
+BENCHMARK(time<reingold_dershowitz >)->DenseRange(ascending, alternating);
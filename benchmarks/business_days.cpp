@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file business_days.cpp
+ *
+ * @brief Command line program that benchmarks business-day arithmetic in
+ * closed form against loops over days, without and with holidays.
+ *
+ * Adding is timed for settlement (T+2) and for 20 business days. Counting is
+ * timed between days up to a year apart. The loops test each day as
+ * business_days::is_business_day does.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "util/business_days.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+auto const rds = [](){
+  // 1 January 1970 to 31 December 2100:
+  std::uniform_int_distribution<int32_t> uniform_dist(0, 47846);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ds;
+  for (int32_t& d : ds)
+    d = uniform_dist(rng);
+  return ds;
+}();
+
+auto const ends = [](){
+  std::uniform_int_distribution<int32_t> uniform_dist(0, 365);
+  std::mt19937 rng(1);
+  std::array<int32_t, rds.size()> ds;
+  for (size_t i = 0; i < ds.size(); ++i)
+    ds[i] = rds[i] + uniform_dist(rng);
+  return ds;
+}();
+
+// 10 a year: 4 on fixed dates and 6 random ones.
+business_days const weekends;
+business_days const holidays([](){
+  std::vector<int32_t> days;
+  std::uniform_int_distribution<uint32_t> uniform_dist(1, 28);
+  std::mt19937 rng;
+  for (int32_t year = 1970; year <= 2101; ++year) {
+    days.push_back(benjoffe_fast64::to_rata_die(year, 1, 1));
+    days.push_back(benjoffe_fast64::to_rata_die(year, 7, 4));
+    days.push_back(benjoffe_fast64::to_rata_die(year, 11, 11));
+    days.push_back(benjoffe_fast64::to_rata_die(year, 12, 25));
+    for (uint32_t month : { 2, 3, 4, 5, 8, 9 })
+      days.push_back(benjoffe_fast64::to_rata_die(year, month,
+        uniform_dist(rng)));
+  }
+  std::sort(days.begin(), days.end());
+  return days;
+}());
+
+static int32_t loop_add(business_days const& b, int32_t rd, int32_t n) {
+  while (n > 0) {
+    ++rd;
+    n -= b.is_business_day(rd);
+  }
+  return rd;
+}
+
+static int32_t loop_between(business_days const& b, int32_t rd1,
+  int32_t rd2) {
+  int32_t count = 0;
+  for (int32_t rd = rd1; rd < rd2; ++rd)
+    count += b.is_business_day(rd);
+  return count;
+}
+
+void scan(benchmark::State& state) {
+  for (auto _ : state)
+    for (int32_t d : rds)
+      benchmark::DoNotOptimize(d);
+}
+
+void add_loop(benchmark::State& state, business_days const* b) {
+  int32_t const n = int32_t(state.range(0));
+  for (auto _ : state)
+    for (int32_t d : rds)
+      benchmark::DoNotOptimize(loop_add(*b, d, n));
+}
+
+void add_business_days(benchmark::State& state, business_days const* b) {
+  int32_t const n = int32_t(state.range(0));
+  std::array<int32_t, rds.size()> results;
+  for (auto _ : state) {
+    b->add_business_days(rds.data(), n, results.data(), rds.size());
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void between_loop(benchmark::State& state, business_days const* b) {
+  for (auto _ : state)
+    for (size_t i = 0; i < rds.size(); ++i)
+      benchmark::DoNotOptimize(loop_between(*b, rds[i], ends[i]));
+}
+
+void business_days_between(benchmark::State& state,
+  business_days const* b) {
+  std::array<int32_t, rds.size()> counts;
+  for (auto _ : state) {
+    b->business_days_between(rds.data(), ends.data(), counts.data(),
+      rds.size());
+    benchmark::DoNotOptimize(counts.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(scan);
+
+BENCHMARK_CAPTURE(add_loop, weekends, &weekends)->Arg(2)->Arg(20);
+BENCHMARK_CAPTURE(add_business_days, weekends, &weekends)->Arg(2)->Arg(20);
+BENCHMARK_CAPTURE(add_loop, holidays, &holidays)->Arg(2)->Arg(20);
+BENCHMARK_CAPTURE(add_business_days, holidays, &holidays)->Arg(2)->Arg(20);
+
+BENCHMARK_CAPTURE(between_loop, weekends, &weekends);
+BENCHMARK_CAPTURE(business_days_between, weekends, &weekends);
+BENCHMARK_CAPTURE(between_loop, holidays, &holidays);
+BENCHMARK_CAPTURE(business_days_between, holidays, &holidays);
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file code_size.cpp
+ *
+ * @brief Command line program that benchmarks to_date and to_rata_die
+ * compiled into isolated, non-inlined functions and reports, next to the
+ * timings, their machine code bytes, instructions and static table bytes,
+ * read from the program's own ELF symbol table.
+ *
+ * The sites benchmarks inline to_date into N distinct call sites of one
+ * function, as in a large binary, and report the bytes per call site.
+ * Once N times the bytes exceeds the instruction cache, the timings show
+ * the cost of the footprint.
+ */
+
+#include "algorithms/baum.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast32_wide.hpp"
+#include "algorithms/boost.hpp"
+#include "algorithms/dotnet.hpp"
+#include "algorithms/fliegel_flandern.hpp"
+#include "algorithms/glibc.hpp"
+#include "algorithms/hatcher.hpp"
+#include "algorithms/libcxx.hpp"
+#include "algorithms/neri_schneider.hpp"
+#include "algorithms/openjdk.hpp"
+#include "algorithms/reingold_dershowitz.hpp"
+#include "eaf/date.hpp"
+#include "util/code_size.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+#if defined(_MSC_VER)
+#define EAF_FLATTEN
+#else
+#define EAF_FLATTEN __attribute__((flatten))
+#endif
+
+auto const rata_dies = [](){
+  // As benchmarks/to_date.cpp: 800 years centered at 1 January 1970.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+auto const dates = [](){
+  std::array<date32_t, 16384> ds;
+  for (size_t i = 0; i < ds.size(); ++i)
+    ds[i] = neri_schneider::to_date(rata_dies[i]);
+  return ds;
+}();
+
+void report(benchmark::State& state, code_size_t const& size,
+  uint64_t sites = 1) {
+  if (size.functions == 0)
+    return; // Not an ELF file or stripped.
+  state.counters["bytes"]  = double(size.bytes) / double(sites);
+  state.counters["insns"]  = double(size.instructions) / double(sites);
+  state.counters["tables"] = double(size.table_bytes);
+}
+
+template <typename A>
+EAF_NOINLINE date32_t isolated_to_date(int32_t n) {
+  return A::to_date(n);
+}
+
+template <typename A>
+EAF_NOINLINE int32_t isolated_to_rata_die(date32_t const& date) {
+  return A::to_rata_die(date.year, date.month, date.day);
+}
+
+// N call sites of A::to_date, each inlined, despite the compiler's limits
+// on growth, and kept apart by the barriers.
+template <typename A, size_t... I>
+EAF_NOINLINE EAF_FLATTEN
+void sites(int32_t const* ns, std::index_sequence<I...>) {
+  (benchmark::DoNotOptimize(A::to_date(ns[I])), ...);
+}
+
+template <typename A, size_t... I>
+auto sites_function(std::index_sequence<I...>) {
+  return &sites<A, I...>;
+}
+
+// Baseline for sites: the loads and barriers without the conversions.
+struct scan {
+  static date32_t to_date(int32_t n) {
+    return { n, 0, 0 };
+  }
+};
+
+template <typename A>
+void time_to_date(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int32_t rata_die : rata_dies) {
+      date32_t date = isolated_to_date<A>(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+  report(state, code_size::measure(&isolated_to_date<A>));
+}
+
+template <typename A>
+void time_to_rata_die(benchmark::State& state) {
+  for (auto _ : state) {
+    for (auto const& date : dates) {
+      int32_t rata_die = isolated_to_rata_die<A>(date);
+      benchmark::DoNotOptimize(rata_die);
+    }
+  }
+  report(state, code_size::measure(&isolated_to_rata_die<A>));
+}
+
+template <typename A, size_t N>
+void time_sites(benchmark::State& state) {
+  for (auto _ : state)
+    for (size_t i = 0; i + N <= rata_dies.size(); i += N)
+      sites<A>(rata_dies.data() + i, std::make_index_sequence<N>());
+  // Bytes per call site, excluding the baseline's:
+  auto const seq = std::make_index_sequence<N>();
+  code_size_t       size     = code_size::measure(sites_function<A>(seq));
+  code_size_t const baseline = code_size::measure(sites_function<scan>(seq));
+  size.bytes        -= std::min(size.bytes, baseline.bytes);
+  size.instructions -= std::min(size.instructions, baseline.instructions);
+  report(state, size, N);
+}
+
+BENCHMARK(time_to_date<boost                 >);
+BENCHMARK(time_to_date<neri_schneider        >);
+BENCHMARK(time_to_date<benjoffe_fast64       >);
+BENCHMARK(time_to_date<benjoffe_fast32       >);
+BENCHMARK(time_to_date<benjoffe_fast32_wide  >);
+BENCHMARK(time_to_date<baum                  >);
+BENCHMARK(time_to_date<dotnet                >);
+BENCHMARK(time_to_date<fliegel_flandern      >);
+BENCHMARK(time_to_date<glibc                 >);
+BENCHMARK(time_to_date<hatcher               >);
+BENCHMARK(time_to_date<libcxx                >);
+BENCHMARK(time_to_date<openjdk               >);
+BENCHMARK(time_to_date<reingold_dershowitz   >);
+
+BENCHMARK(time_to_rata_die<boost               >);
+BENCHMARK(time_to_rata_die<neri_schneider      >);
+BENCHMARK(time_to_rata_die<benjoffe_fast64     >);
+BENCHMARK(time_to_rata_die<baum                >);
+BENCHMARK(time_to_rata_die<dotnet              >);
+BENCHMARK(time_to_rata_die<fliegel_flandern    >);
+BENCHMARK(time_to_rata_die<glibc               >);
+BENCHMARK(time_to_rata_die<hatcher             >);
+BENCHMARK(time_to_rata_die<libcxx              >);
+BENCHMARK(time_to_rata_die<openjdk             >);
+BENCHMARK(time_to_rata_die<reingold_dershowitz >);
+
+#define EAF_SITES(A)                 \
+  BENCHMARK(time_sites<A, 1   >);    \
+  BENCHMARK(time_sites<A, 32  >);    \
+  BENCHMARK(time_sites<A, 256 >)
+
+EAF_SITES(neri_schneider);
+EAF_SITES(benjoffe_fast64);
+EAF_SITES(benjoffe_fast32);
+EAF_SITES(dotnet);
+EAF_SITES(glibc);
+EAF_SITES(openjdk);
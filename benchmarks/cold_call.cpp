@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file cold_call.cpp
+ *
+ * @brief Command line program that benchmarks the latency of single calls
+ * to to_date and to_rata_die, as made sporadically between unrelated work,
+ * with cold caches and branch predictors.
+ *
+ * Before each timed call in cold mode (argument 1), the lines of the code
+ * and tables of the conversion, found in the program's ELF symbols (see
+ * util/code_size.hpp), are flushed by clflush and the branch predictors are
+ * trained on thousands of random branches. Warm mode (argument 0) skips
+ * both. A call is timed by rdtsc, serialised by lfence, and the p50 and p99
+ * counters give its latency in TSC ticks, including the overhead of timing
+ * (see scan). Only x86-64 is supported. (The time columns include the
+ * flushing and are meaningless.)
+ */
+
+#include "algorithms/baum.hpp"
+#include "algorithms/benjoffe_article_2_l1.hpp"
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/boost.hpp"
+#include "algorithms/dotnet.hpp"
+#include "algorithms/glibc.hpp"
+#include "algorithms/libcxx.hpp"
+#include "algorithms/neri_schneider.hpp"
+#include "algorithms/openjdk.hpp"
+#include "algorithms/reingold_dershowitz.hpp"
+#include "eaf/date.hpp"
+#include "util/code_size.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EAF_COLD_CALL 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define EAF_COLD_CALL 0
+#endif
+
+auto const rata_dies = [](){
+  // As benchmarks/to_date.cpp: 800 years centered at 1 January 1970.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+auto const dates = [](){
+  std::array<date32_t, 16384> ds;
+  for (size_t i = 0; i < ds.size(); ++i)
+    ds[i] = neri_schneider::to_date(rata_dies[i]);
+  return ds;
+}();
+
+// Identity, for the overhead of timing.
+struct scan {
+  static date32_t to_date(int32_t n) {
+    return { n, 0, 0 };
+  }
+  static int32_t to_rata_die(int32_t year, uint32_t, uint32_t) {
+    return year;
+  }
+};
+
+template <typename A>
+EAF_NOINLINE date32_t isolated_to_date(int32_t n) {
+  return A::to_date(n);
+}
+
+template <typename A>
+EAF_NOINLINE int32_t isolated_to_rata_die(date32_t const& date) {
+  return A::to_rata_die(date.year, date.month, date.day);
+}
+
+#if EAF_COLD_CALL
+
+// Distinct conditional branches, taken at random, repeatedly. Each site
+// calls into a barrier, which keeps it a branch rather than a select.
+template <size_t... I>
+EAF_NOINLINE uint64_t thrash(uint64_t x, std::index_sequence<I...>) {
+  for (uint32_t i = 0; i < 16; ++i)
+    ((x = x * 6364136223846793005ull + 1442695040888963407ull,
+      x >> 63 ? benchmark::DoNotOptimize(x ^= I) : void()), ...);
+  return x;
+}
+
+void flush(code_size_t const& footprint) {
+  uint64_t const bias = code_size::self_bias();
+  for (elf_symbol_t const* s : footprint.symbols)
+    for (uint64_t a = s->address & ~uint64_t(63); a < s->address + s->size;
+      a += 64)
+      _mm_clflush(reinterpret_cast<void const*>(a + bias));
+  _mm_mfence();
+}
+
+template <typename F, typename T>
+uint64_t ticks(F f, T const& input) {
+  unsigned aux;
+  _mm_lfence();
+  uint64_t const start = __rdtsc();
+  _mm_lfence();
+  auto const output = f(input);
+  benchmark::DoNotOptimize(output);
+  uint64_t const stop = __rdtscp(&aux);
+  _mm_lfence();
+  return stop - start;
+}
+
+#endif
+
+template <typename F, typename Inputs>
+void time_calls(benchmark::State& state, F* f, Inputs const& inputs) {
+#if EAF_COLD_CALL
+  bool const cold = state.range(0) != 0;
+  code_size_t const footprint = code_size::measure(f);
+  if (cold && footprint.functions == 0) {
+    state.SkipWithError("No ELF symbols to flush.");
+    return;
+  }
+  std::vector<uint64_t> samples;
+  samples.reserve(state.max_iterations);
+  uint64_t x = 1;
+  size_t i = 0;
+  for (auto _ : state) {
+    if (cold) {
+      x = thrash(x, std::make_index_sequence<1024>());
+      flush(footprint);
+    }
+    samples.push_back(ticks(f, inputs[i++ % inputs.size()]));
+  }
+  std::sort(samples.begin(), samples.end());
+  state.counters["p50"] = double(samples[samples.size() / 2]);
+  state.counters["p99"] = double(samples[samples.size() * 99 / 100]);
+#else
+  (void) f;
+  (void) inputs;
+  state.SkipWithError("Needs x86-64 (clflush and rdtsc).");
+#endif
+}
+
+template <typename A>
+void time_to_date(benchmark::State& state) {
+  time_calls(state, &isolated_to_date<A>, rata_dies);
+}
+
+template <typename A>
+void time_to_rata_die(benchmark::State& state) {
+  time_calls(state, &isolated_to_rata_die<A>, dates);
+}
+
+// Arguments: 0 for warm and 1 for cold.
+void modes(benchmark::internal::Benchmark* b) {
+  b->Arg(0)->Arg(1)->Iterations(10000);
+}
+
+BENCHMARK(time_to_date<scan                 >)->Apply(modes);
+BENCHMARK(time_to_date<neri_schneider       >)->Apply(modes);
+BENCHMARK(time_to_date<benjoffe_fast64      >)->Apply(modes);
+BENCHMARK(time_to_date<benjoffe_fast32      >)->Apply(modes);
+BENCHMARK(time_to_date<benjoffe_article_2_l1>)->Apply(modes);
+BENCHMARK(time_to_date<baum                 >)->Apply(modes);
+BENCHMARK(time_to_date<boost                >)->Apply(modes);
+BENCHMARK(time_to_date<dotnet               >)->Apply(modes);
+BENCHMARK(time_to_date<glibc                >)->Apply(modes);
+BENCHMARK(time_to_date<libcxx               >)->Apply(modes);
+BENCHMARK(time_to_date<openjdk              >)->Apply(modes);
+BENCHMARK(time_to_date<reingold_dershowitz  >)->Apply(modes);
+
+BENCHMARK(time_to_rata_die<scan             >)->Apply(modes);
+BENCHMARK(time_to_rata_die<neri_schneider   >)->Apply(modes);
+BENCHMARK(time_to_rata_die<benjoffe_fast64  >)->Apply(modes);
+BENCHMARK(time_to_rata_die<dotnet           >)->Apply(modes);
+BENCHMARK(time_to_rata_die<glibc            >)->Apply(modes);
+BENCHMARK(time_to_rata_die<openjdk          >)->Apply(modes);
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file date_filter.cpp
+ *
+ * @brief Command line program that benchmarks calendar predicates compiled
+ * to intervals of day numbers against decoding every day and comparing.
+ *
+ * The build adds -mavx2 where the host runs AVX2, for the vector forms of
+ * the scan.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/date_filter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// 1970 to 2030:
+day_interval_t const domain = { 0, 21914 };
+
+auto const days = [](){
+  std::uniform_int_distribution<int32_t> uniform_dist(domain.first,
+    domain.last);
+  std::mt19937 rng;
+  std::vector<int32_t> ns(1 << 20);
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+// Predicates from selective to non-selective. Arguments index this array.
+date_predicate_t const predicates[] = {
+  { 2005, 2005, 1 << 2, 0xfffffffe },     // February 2005: 1 interval
+  { 2000, 2010, 0x1ffe, 0xfffffffe },     // 2000 to 2010:  1 interval
+  { INT32_MIN, INT32_MAX, 1 << 2, 0xfffffffe }, // February: 60 intervals
+  { INT32_MIN, INT32_MAX, 0x1ffe, 1 << 1 },     // First day: 720 intervals
+  { INT32_MIN, INT32_MAX, 0x1ffe & ~(1 << 2), 0xfffffffe }, // Not Feb.: 61
+};
+
+struct decode {
+
+  static void select(date_predicate_t const& predicate,
+    int32_t const* ns, size_t count, uint64_t* selection) {
+    for (size_t i = 0; i < count; i += 64) {
+      uint64_t mask = 0;
+      for (size_t j = 0; j < 64 && i + j < count; ++j) {
+        date32_t const date = benjoffe_fast64::to_date(ns[i + j]);
+        bool const selected = predicate.year_min <= date.year &&
+          date.year <= predicate.year_max &&
+          (predicate.months >> date.month & 1) &&
+          (predicate.days >> date.day & 1);
+        mask |= uint64_t(selected) << j;
+      }
+      selection[i / 64] = mask;
+    }
+  }
+};
+
+struct compiled {};
+
+// Compiled for a domain too large for a bitmap, 1000000 days either side of
+// 1970, hence binary searched.
+struct searched {};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<decode>(benchmark::State& state) {
+  date_predicate_t const& predicate = predicates[state.range(0)];
+  std::vector<uint64_t> selection(days.size() / 64);
+  for (auto _ : state) {
+    decode::select(predicate, days.data(), days.size(), selection.data());
+    benchmark::DoNotOptimize(selection.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  date_filter const filter = date_filter::compile(predicates[state.range(0)],
+    std::is_same_v<A, searched> ? day_interval_t{ -1000000, 1000000 } :
+    domain);
+  std::vector<uint64_t> selection(days.size() / 64);
+  for (auto _ : state) {
+    filter.select(days.data(), days.size(), selection.data());
+    benchmark::DoNotOptimize(selection.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["intervals"] = double(filter.intervals().size());
+}
+
+BENCHMARK(time<decode  >)->DenseRange(0, 4);
+BENCHMARK(time<compiled>)->DenseRange(0, 4);
+BENCHMARK(time<searched>)->DenseRange(0, 4);
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file date_trunc.cpp
+ *
+ * @brief Command line program that benchmarks the period truncation kernels
+ * against to_date followed by to_rata_die of the first day of the period.
+ */
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/date_trunc.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+auto const rata_dies = [](){
+  // 800 years centered at 1 January 1970 (Unix epoch), as in to_date.cpp.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+using period = date_trunc::period;
+
+// Decode and re-encode.
+template <typename A>
+struct round_trip {
+
+  static int32_t to_week_start(int32_t n) {
+    // Not a calendar operation:
+    return A::to_week_start(n);
+  }
+
+  static int32_t to_month_start(int32_t n) {
+    date32_t const date = A::to_date(n);
+    return A::to_rata_die(date.year, date.month, 1);
+  }
+
+  static int32_t to_quarter_start(int32_t n) {
+    date32_t const date = A::to_date(n);
+    return A::to_rata_die(date.year, date.month - (date.month - 1) % 3, 1);
+  }
+
+  static int32_t to_year_start(int32_t n) {
+    date32_t const date = A::to_date(n);
+    return A::to_rata_die(date.year, 1, 1);
+  }
+};
+
+struct scan {};
+
+template <period P, typename A>
+void time(benchmark::State& state) {
+  std::array<int32_t, rata_dies.size()> starts;
+  for (auto _ : state) {
+    date_trunc::to_start<P, A>(rata_dies.data(), starts.data(),
+      rata_dies.size());
+    benchmark::DoNotOptimize(starts.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <>
+void time<period::week, scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (int32_t rata_die : rata_dies)
+      benchmark::DoNotOptimize(rata_die);
+}
+
+BENCHMARK(time<period::week,    scan                         >);
+BENCHMARK(time<period::week,    benjoffe_fast64              >);
+BENCHMARK(time<period::month,   round_trip<benjoffe_fast64>  >);
+BENCHMARK(time<period::month,   benjoffe_fast64              >);
+BENCHMARK(time<period::quarter, round_trip<benjoffe_fast64>  >);
+BENCHMARK(time<period::quarter, benjoffe_fast64              >);
+BENCHMARK(time<period::year,    round_trip<benjoffe_fast64>  >);
+BENCHMARK(time<period::year,    benjoffe_fast64              >);
+BENCHMARK(time<period::month,   round_trip<benjoffe_fast32>  >);
+BENCHMARK(time<period::month,   benjoffe_fast32              >);
+BENCHMARK(time<period::quarter, round_trip<benjoffe_fast32>  >);
+BENCHMARK(time<period::quarter, benjoffe_fast32              >);
+BENCHMARK(time<period::year,    round_trip<benjoffe_fast32>  >);
+BENCHMARK(time<period::year,    benjoffe_fast32              >);
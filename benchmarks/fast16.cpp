@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file fast16.cpp
+ *
+ * @brief Command line program that benchmarks the batch conversions of
+ * int16_t day number columns by benjoffe_fast16 against widening to int32_t
+ * and calling the 32-bit algorithms.
+ *
+ * All produce the same columns: int16_t years and uint8_t months and days.
+ * The build adds -mavx2 where the host runs AVX2 (16 lanes of 16 bits per
+ * register), and builds it again as fast16_avx512bw with -mavx512bw where
+ * the host runs AVX-512BW (32 lanes).
+ */
+
+#include "algorithms/benjoffe_fast16.hpp"
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+size_t constexpr count = 16384;
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<int32_t> uniform_dist(INT16_MIN, INT16_MAX);
+  std::mt19937 rng;
+  std::vector<int16_t> ns(count);
+  for (int16_t& n : ns)
+    n = int16_t(uniform_dist(rng));
+  return ns;
+}();
+
+// Columns of the dates of rata_dies.
+struct columns_t {
+  std::vector<int16_t> years;
+  std::vector<uint8_t> months;
+  std::vector<uint8_t> days;
+};
+
+auto const dates = [](){
+  columns_t c = { std::vector<int16_t>(count), std::vector<uint8_t>(count),
+    std::vector<uint8_t>(count) };
+  benjoffe_fast16::to_date(rata_dies.data(), c.years.data(), c.months.data(),
+    c.days.data(), count);
+  return c;
+}();
+
+// Batch forms of a 32-bit algorithm on the same columns.
+template <typename A>
+struct widened {
+
+  static inline
+  void to_date(int16_t const* dayNumbers, int16_t* years, uint8_t* months,
+    uint8_t* days, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      date32_t const date = A::to_date(int32_t(dayNumbers[i]));
+      years[i]  = int16_t(date.year);
+      months[i] = uint8_t(date.month);
+      days[i]   = uint8_t(date.day);
+    }
+  }
+
+  static inline
+  void to_rata_die(int16_t const* years, uint8_t const* months,
+    uint8_t const* days, int16_t* dayNumbers, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+      dayNumbers[i] = int16_t(A::to_rata_die(years[i], months[i], days[i]));
+  }
+};
+
+template <typename A>
+void to_date(benchmark::State& state) {
+  columns_t c = { std::vector<int16_t>(count), std::vector<uint8_t>(count),
+    std::vector<uint8_t>(count) };
+  for (auto _ : state) {
+    A::to_date(rata_dies.data(), c.years.data(), c.months.data(),
+      c.days.data(), count);
+    benchmark::DoNotOptimize(c.years.data());
+    benchmark::DoNotOptimize(c.months.data());
+    benchmark::DoNotOptimize(c.days.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename A>
+void to_rata_die(benchmark::State& state) {
+  std::vector<int16_t> ns(count);
+  for (auto _ : state) {
+    A::to_rata_die(dates.years.data(), dates.months.data(), dates.days.data(),
+      ns.data(), count);
+    benchmark::DoNotOptimize(ns.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(to_date<widened<benjoffe_fast32>    >);
+BENCHMARK(to_date<widened<benjoffe_fast64>    >);
+BENCHMARK(to_date<benjoffe_fast16             >);
+BENCHMARK(to_rata_die<widened<benjoffe_fast32>>);
+BENCHMARK(to_rata_die<widened<benjoffe_fast64>>);
+BENCHMARK(to_rata_die<benjoffe_fast16         >);
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file from_fractional_day.cpp
+ *
+ * @brief Command line program that benchmarks conversions of Julian Dates
+ * given as doubles to a date and a nanosecond of day.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/firefox.hpp"
+#include "eaf/date.hpp"
+#include "util/fractional_day.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+auto const julian_dates = [](){
+  // 800 years centered at 1 January 1970 (Unix epoch), that is, Julian Date
+  // 2440587.5, with random times of day.
+  std::uniform_real_distribution<double> uniform_dist(2440587.5 - 146097,
+    2440587.5 + 146097);
+  std::mt19937 rng;
+  std::array<double, 16384> jds;
+  for (double& jd : jds)
+    jd = uniform_dist(rng);
+  return jds;
+}();
+
+struct date_time_t {
+  date32_t date;
+  uint64_t nanosecond;
+};
+
+struct scan {};
+
+// Double arithmetic throughout, as in jsdate.cpp, on milliseconds since the
+// Unix epoch.
+struct firefox_double {
+
+  static inline
+  date_time_t from_julian_date(double jd) {
+    double const t = (jd - 2440587.5) * firefox::msPerDay;
+    double const y = firefox::YearFromTime(t);
+    double const m = firefox::MonthFromTime(t);
+    double const d = firefox::DateFromTime(t);
+    double ms = std::fmod(t, firefox::msPerDay);
+    if (ms < 0)
+      ms += firefox::msPerDay;
+    return { { int32_t(y), uint32_t(m) + 1, uint32_t(d) },
+      uint64_t(ms * 1000000) };
+  }
+};
+
+// floor, then the integer algorithm.
+struct naive_floor {
+
+  static inline
+  date_time_t from_julian_date(double jd) {
+    double const civil = jd + 0.5;
+    double const day = std::floor(civil);
+    uint64_t const ns = uint64_t((civil - day) * fractional_day::NS_PER_DAY);
+    return { benjoffe_fast64_jdn::to_date(int32_t(day)), ns };
+  }
+};
+
+// Exact splitting, then the integer algorithm.
+struct fractional_day_scalar {
+
+  static inline
+  date_time_t from_julian_date(double jd) {
+    day_time_t const dt = fractional_day::from_julian_date(jd);
+    return { benjoffe_fast64_jdn::to_date(dt.day), dt.nanosecond };
+  }
+};
+
+struct fractional_day_batch {};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (double jd : julian_dates)
+      benchmark::DoNotOptimize(jd);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  for (auto _ : state) {
+    for (double jd : julian_dates) {
+      date_time_t date_time = A::from_julian_date(jd);
+      benchmark::DoNotOptimize(date_time);
+    }
+  }
+}
+
+template <>
+void time<fractional_day_batch>(benchmark::State& state) {
+  std::array<date32_t, julian_dates.size()> dates;
+  std::array<uint64_t, julian_dates.size()> nanoseconds;
+  for (auto _ : state) {
+    fractional_day::from_julian_date(julian_dates.data(), dates.data(),
+      nanoseconds.data(), julian_dates.size());
+    benchmark::DoNotOptimize(dates.data());
+    benchmark::DoNotOptimize(nanoseconds.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(time<scan                 >);
+BENCHMARK(time<firefox_double       >);
+BENCHMARK(time<naive_floor          >);
+BENCHMARK(time<fractional_day_scalar>);
+BENCHMARK(time<fractional_day_batch >);
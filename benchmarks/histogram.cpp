@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file histogram.cpp
+ *
+ * @brief Command line program that benchmarks histograms by month against
+ * decoding every day to a date, for different distributions of days and
+ * numbers of threads.
+ *
+ * The build adds -mavx2 where the host runs AVX2, for the vector bins of
+ * benjoffe_fast32 (8 lanes of 32 bits per register), and builds it again as
+ * histogram_avx512 with -mavx512f where the host runs AVX-512 (16 lanes).
+ */
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/histogram.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// 1990 to 2030:
+month_range_t const range = { 1990, 12 * 40 };
+
+size_t const count = 1 << 20;
+
+enum distribution {
+  uniform,   // 1990 to 2030
+  recent,    // The last two years, as typical event tables
+  sorted,    // uniform, sorted as a time-ordered column
+};
+
+std::vector<int32_t> make_days(distribution d) {
+  std::mt19937 rng;
+  std::uniform_int_distribution<int32_t> uniform_dist(7305, 21914);
+  std::uniform_int_distribution<int32_t> recent_dist(19724, 20453);
+  std::vector<int32_t> days(count);
+  for (int32_t& n : days)
+    n = d == recent ? recent_dist(rng) : uniform_dist(rng);
+  if (d == sorted)
+    std::sort(days.begin(), days.end());
+  return days;
+}
+
+std::vector<int32_t> const days[] = {
+  make_days(uniform), make_days(recent), make_days(sorted),
+};
+
+struct scan {};
+
+// Decode every day to a date and increment its counter.
+template <typename A>
+struct decode {};
+
+// A through the scalar form of month_bins.
+template <typename A>
+struct scalar_bins {
+  static int32_t to_month_index(int32_t n) { return A::to_month_index(n); }
+};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<scan>(benchmark::State& state) {
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  for (auto _ : state)
+    for (int32_t n : ns)
+      benchmark::DoNotOptimize(n);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  std::vector<uint32_t> counts(range.months);
+  for (auto _ : state) {
+    histogram_by_month<A>(ns.data(), ns.size(), range, counts.data(),
+      unsigned(state.range(1)));
+    benchmark::DoNotOptimize(counts.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <>
+void time<decode<benjoffe_fast64>>(benchmark::State& state) {
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  std::vector<uint32_t> counts(range.months);
+  for (auto _ : state) {
+    for (int32_t n : ns) {
+      date32_t const date = benjoffe_fast64::to_date(n);
+      uint32_t const bin = uint32_t(date.year - range.year) * 12 + date.month -
+        1;
+      if (bin < range.months)
+        ++counts[bin];
+    }
+    benchmark::DoNotOptimize(counts.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+// Arguments: distribution and number of threads.
+void distributions(benchmark::internal::Benchmark* b) {
+  for (int d : { uniform, recent, sorted })
+    b->Args({ d, 1 });
+}
+
+void scaling(benchmark::internal::Benchmark* b) {
+  for (int threads : { 1, 2, 4, 8 })
+    b->Args({ uniform, threads });
+}
+
+BENCHMARK(time<scan                         >)->Apply(distributions);
+BENCHMARK(time<decode<benjoffe_fast64>      >)->Apply(distributions);
+BENCHMARK(time<benjoffe_fast64              >)->Apply(distributions);
+BENCHMARK(time<scalar_bins<benjoffe_fast32> >)->Apply(distributions);
+BENCHMARK(time<benjoffe_fast32              >)->Apply(distributions);
+BENCHMARK(time<benjoffe_fast32              >)->Apply(scaling)->UseRealTime();
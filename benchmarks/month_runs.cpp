@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file month_runs.cpp
+ *
+ * @brief Command line program that benchmarks finding the runs of months of
+ * sorted columns by galloping against decoding every day.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/month_runs.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+size_t const count = 1 << 20;
+
+enum distribution {
+  logs,   // Two years of events, busier on weekdays and growing
+  sparse, // Days spread over 5000 years, about 15 per month
+};
+
+std::vector<int32_t> make_days(distribution d) {
+  std::mt19937 rng;
+  std::vector<int32_t> days;
+  days.reserve(count);
+  if (d == logs) {
+    // From 1 January 2023, a Sunday.
+    for (int32_t n = 19358; days.size() < count; ++n) {
+      bool const weekend = (n + 3) % 7 >= 5; // Monday = 0
+      double const mean = (weekend ? 600 : 1600) * (1 + (n - 19358) / 730.0);
+      std::poisson_distribution<int32_t> poisson_dist(mean);
+      for (int32_t i = poisson_dist(rng); i > 0 && days.size() < count; --i)
+        days.push_back(n);
+    }
+  }
+  else {
+    std::uniform_int_distribution<int32_t> uniform_dist(-913000, 913000);
+    for (size_t i = 0; i < count; ++i)
+      days.push_back(uniform_dist(rng));
+    std::sort(days.begin(), days.end());
+  }
+  return days;
+}
+
+std::vector<int32_t> const days[] = {
+  make_days(logs), make_days(sparse),
+};
+
+struct scan {};
+
+// Decode every day to a date and start a run when the month changes.
+struct decode {
+
+  static std::vector<month_run_t> runs(int32_t const* ns, size_t count) {
+    std::vector<month_run_t> runs;
+    for (size_t i = 0; i < count; ++i) {
+      date32_t const date = benjoffe_fast64::to_date(ns[i]);
+      int32_t const month = date.year * 12 + int32_t(date.month) - 1;
+      if (runs.empty() || runs.back().month != month)
+        runs.push_back({ month, i, i });
+      runs.back().end = i + 1;
+    }
+    return runs;
+  }
+};
+
+// As above with to_month_index, which skips the day of month.
+struct month_index {
+
+  static std::vector<month_run_t> runs(int32_t const* ns, size_t count) {
+    std::vector<month_run_t> runs;
+    for (size_t i = 0; i < count; ++i) {
+      int32_t const month = benjoffe_fast64::to_month_index(ns[i]);
+      if (runs.empty() || runs.back().month != month)
+        runs.push_back({ month, i, i });
+      runs.back().end = i + 1;
+    }
+    return runs;
+  }
+};
+
+struct galloping {
+
+  static std::vector<month_run_t> runs(int32_t const* ns, size_t count) {
+    return month_runs(ns, count);
+  }
+};
+
+template <typename A>
+void time(benchmark::State& state) {
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  size_t runs = 0;
+  for (auto _ : state) {
+    std::vector<month_run_t> const r = A::runs(ns.data(), ns.size());
+    runs = r.size();
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.counters["runs"] = double(runs);
+}
+
+template <>
+void time<scan>(benchmark::State& state) {
+  std::vector<int32_t> const& ns = days[state.range(0)];
+  for (auto _ : state)
+    for (int32_t n : ns)
+      benchmark::DoNotOptimize(n);
+}
+
+BENCHMARK(time<scan       >)->DenseRange(logs, sparse);
+BENCHMARK(time<decode     >)->DenseRange(logs, sparse);
+BENCHMARK(time<month_index>)->DenseRange(logs, sparse);
+BENCHMARK(time<galloping  >)->DenseRange(logs, sparse);
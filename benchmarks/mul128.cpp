@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file mul128.cpp
+ *
+ * @brief Command line program that benchmarks benjoffe_fast64 and
+ * ordinal_benjoffe_fast64 with each 128-bit multiply policy.
+ *
+ * This file is built for the baseline ISA, so that native is timed as
+ * shipped. Where the host runs BMI2, mul128_mulx.cpp, built with -mbmi2, adds
+ * the mulx policy. portable shows the cost on targets without a 128-bit
+ * multiply.
+ */
+
+#include "benchmarks/mul128.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+std::array<int32_t, 16384> const rata_dies = [](){
+  // 800 years centered at 1 January 1970, as to_date.
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+struct scan {};
+
+template <>
+void time<scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (int32_t rata_die : rata_dies)
+      benchmark::DoNotOptimize(rata_die);
+}
+
+using native   = eaf::mul128::native;
+using portable = eaf::mul128::portable;
+
+BENCHMARK(time<scan                  >);
+BENCHMARK(time<fast64<native>        >);
+BENCHMARK(time<fast64<portable>      >);
+BENCHMARK(time<ordinal64<native>     >);
+BENCHMARK(time<ordinal64<portable>   >);
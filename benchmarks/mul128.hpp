@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file mul128.hpp
+ *
+ * @brief Inputs and timing loop shared by mul128.cpp and mul128_mulx.cpp.
+ */
+
+#ifndef EAF_BENCHMARKS_MUL128_HPP
+#define EAF_BENCHMARKS_MUL128_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms_ordinal/ordinal_benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "eaf/mul128.hpp"
+#include "util/ordinal.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+// Defined in mul128.cpp.
+extern std::array<int32_t, 16384> const rata_dies;
+
+template <typename M>
+using fast64 = benjoffe_fast64_t<epoch::unix_time, eaf::bounds::unchecked,
+  eaf::variant::native, M>;
+
+template <typename M>
+using ordinal64 = ordinal_benjoffe_fast64_t<epoch::unix_time,
+  eaf::bounds::unchecked, M>;
+
+template <typename A>
+void time(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int32_t rata_die : rata_dies) {
+      auto date = A::to_date(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+}
+
+#endif // EAF_BENCHMARKS_MUL128_HPP
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file mul128_mulx.cpp
+ *
+ * @brief The mulx policy of mul128.cpp, in a file of its own so that only it
+ * is built with -mbmi2 (where the host runs BMI2).
+ */
+
+#include "benchmarks/mul128.hpp"
+
+#if defined(__BMI2__)
+
+using mulx = eaf::mul128::mulx;
+
+BENCHMARK(time<fast64<mulx>          >);
+BENCHMARK(time<ordinal64<mulx>       >);
+
+#endif
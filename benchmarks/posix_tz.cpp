@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file posix_tz.cpp
+ *
+ * @brief Command line program that benchmarks conversions of UTC seconds to
+ * local time by a POSIX TZ rule string: posix_tz against localtime_r with TZ
+ * set to the same string.
+ *
+ * localtime_r fills a struct tm. posix_tz is timed alone (local seconds) and
+ * followed by the same job as to_tm.cpp's days_to_tm on the local seconds.
+ * localtime_r is not timed on Windows, which lacks it.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/posix_tz.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+
+char const* const rule = "CET-1CEST,M3.5.0,M10.5.0/3";
+
+auto const seconds = [](){
+  // 1 January 1970 to 31 December 2100, the range where glibc applies the
+  // rules (see posix_tz_tests.cpp).
+  std::uniform_int_distribution<int64_t> uniform_dist(0, 4133980799);
+  std::mt19937 rng;
+  std::array<int64_t, 16384> ts;
+  for (int64_t& t : ts)
+    t = uniform_dist(rng);
+  return ts;
+}();
+
+posix_tz const tz(rule);
+
+// Days before each month in common years.
+uint32_t constexpr days_before[] = {
+  0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+// days_to_tm<benjoffe_fast64> of to_tm.cpp on local seconds, plus the
+// fields that localtime_r also fills.
+static void local_to_tm(int64_t local, int32_t offset, bool dst,
+  std::tm* tm) {
+  int64_t const days = local / 86400 - (local % 86400 < 0);
+  int32_t const secs = int32_t(local - days * 86400);
+  date32_t const date = benjoffe_fast64::to_date(int32_t(days));
+  bool const leap = date.year % 4 == 0 &&
+    (date.year % 100 != 0 || date.year % 400 == 0);
+  tm->tm_year   = date.year - 1900;
+  tm->tm_mon    = int(date.month) - 1;
+  tm->tm_mday   = int(date.day);
+  tm->tm_wday   = int((benjoffe_fast64::weekday(int32_t(days)) + 1) % 7);
+  tm->tm_yday   = int(days_before[date.month - 1] + date.day - 1 +
+    (leap && date.month > 2));
+  tm->tm_hour   = secs / 3600;
+  tm->tm_min    = secs / 60 % 60;
+  tm->tm_sec    = secs % 60;
+  tm->tm_isdst  = dst;
+#if !defined(_WIN32)
+  tm->tm_gmtoff = offset;
+#else
+  (void) offset;
+#endif
+}
+
+void scan(benchmark::State& state) {
+  for (auto _ : state)
+    for (int64_t t : seconds)
+      benchmark::DoNotOptimize(t);
+}
+
+BENCHMARK(scan);
+
+#if !defined(_WIN32)
+
+void localtime_r(benchmark::State& state) {
+  setenv("TZ", rule, 1);
+  tzset();
+  for (auto _ : state) {
+    for (int64_t t : seconds) {
+      std::time_t const time = std::time_t(t);
+      std::tm tm;
+      ::localtime_r(&time, &tm);
+      benchmark::DoNotOptimize(tm);
+    }
+  }
+}
+
+BENCHMARK(localtime_r);
+
+#endif // !defined(_WIN32)
+
+void posix_tz_to_local(benchmark::State& state) {
+  std::array<int64_t, seconds.size()> local;
+  for (auto _ : state) {
+    tz.to_local(seconds.data(), local.data(), seconds.size());
+    benchmark::DoNotOptimize(local.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void posix_tz_to_tm(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int64_t t : seconds) {
+      int32_t const offset = tz.offset(t);
+      std::tm tm;
+      local_to_tm(t + offset, offset, offset == tz.dst_offset(), &tm);
+      benchmark::DoNotOptimize(tm);
+    }
+  }
+}
+
+BENCHMARK(posix_tz_to_local);
+BENCHMARK(posix_tz_to_tm);
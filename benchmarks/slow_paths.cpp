@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file slow_paths.cpp
+ *
+ * @brief Command line program that benchmarks the competitor algorithms
+ * with data-dependent slow paths on different distributions of inputs and
+ * reports how often, per call, each slow path is taken.
+ *
+ * This program is built with EAF_COUNT_SLOW_PATHS defined (see
+ * eaf/slow_paths.hpp), whose counting adds to the timings. For timings
+ * without it, see to_date.
+ */
+
+#include "algorithms/dotnet.hpp"
+#include "algorithms/firefox.hpp"
+#include "algorithms/glibc.hpp"
+#include "algorithms/openjdk.hpp"
+#include "eaf/date.hpp"
+#include "eaf/slow_paths.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+
+#ifndef EAF_COUNT_SLOW_PATHS
+#error "slow_paths must be built with EAF_COUNT_SLOW_PATHS defined."
+#endif
+
+using eaf::slow_paths;
+
+enum distribution {
+  uniform,   // 1570 to 2370, as to_date
+  recent,    // 2000 to 2030
+  year_ends, // Within two days of 1 January, 1570 to 2370
+  ancient,   // 1 to 1570
+};
+
+std::array<int32_t, 16384> make_days(distribution d) {
+  std::mt19937 rng;
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::uniform_int_distribution<int32_t> recent_dist(10957, 21914);
+  std::uniform_int_distribution<int32_t> year_dist(1570, 2369);
+  std::uniform_int_distribution<int32_t> offset_dist(-2, 1);
+  std::uniform_int_distribution<int32_t> ancient_dist(-719162, -146098);
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns) {
+    if (d == uniform)
+      n = uniform_dist(rng);
+    else if (d == recent)
+      n = recent_dist(rng);
+    else if (d == year_ends)
+      n = dotnet::to_rata_die(year_dist(rng), 1, 1) + offset_dist(rng);
+    else
+      n = ancient_dist(rng);
+  }
+  return ns;
+}
+
+std::array<int32_t, 16384> const days[] = {
+  make_days(uniform), make_days(recent), make_days(year_ends),
+  make_days(ancient),
+};
+
+template <typename A>
+std::initializer_list<slow_paths::path_t> const paths;
+
+template <>
+std::initializer_list<slow_paths::path_t> const paths<glibc> = {
+  slow_paths::glibc_year_loop };
+
+template <>
+std::initializer_list<slow_paths::path_t> const paths<openjdk> = {
+  slow_paths::openjdk_doy_fix };
+
+template <>
+std::initializer_list<slow_paths::path_t> const paths<firefox> = {
+  slow_paths::firefox_year_dec, slow_paths::firefox_year_inc };
+
+template <>
+std::initializer_list<slow_paths::path_t> const paths<dotnet> = {
+  slow_paths::dotnet_month_loop };
+
+template <typename A>
+void time(benchmark::State& state) {
+  auto const& ns = days[state.range(0)];
+  slow_paths::reset();
+  for (auto _ : state) {
+    for (int32_t rata_die : ns) {
+      date32_t date = A::to_date(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+  // Per call:
+  double const calls = double(state.iterations()) * double(ns.size());
+  for (slow_paths::path_t path : paths<A>)
+    state.counters[slow_paths::name(path)] =
+      double(slow_paths::counters[path]) / calls;
+}
+
+BENCHMARK(time<glibc  >)->DenseRange(uniform, ancient);
+BENCHMARK(time<openjdk>)->DenseRange(uniform, ancient);
+BENCHMARK(time<firefox>)->DenseRange(uniform, ancient);
+BENCHMARK(time<dotnet >)->DenseRange(uniform, ancient);
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file strftime_format.cpp
+ *
+ * @brief Command line program that benchmarks formatting of seconds since
+ * 1 January 1970 per pattern: strftime_format against strftime.
+ *
+ * strftime is timed on gmtime_r's struct tm (the whole job) and on struct tm
+ * filled beforehand (formatting alone). strftime_format is timed in batch
+ * from the seconds. gmtime_r is not timed on Windows, which lacks it.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/strftime_format.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <random>
+#include <vector>
+
+auto const seconds = [](){
+  // 1 January 1970 to 31 December 2100:
+  std::uniform_int_distribution<int64_t> uniform_dist(0, 4133980799);
+  std::mt19937 rng;
+  std::array<int64_t, 16384> ts;
+  for (int64_t& t : ts)
+    t = uniform_dist(rng);
+  return ts;
+}();
+
+auto const tms = [](){
+  std::array<std::tm, seconds.size()> tms;
+  for (size_t i = 0; i < seconds.size(); ++i) {
+    // As gmtime_r, from days since 1 January 1970:
+    int64_t const days = seconds[i] / 86400;
+    int64_t const secs = seconds[i] % 86400;
+    date32_t const date = benjoffe_fast64::to_date(int32_t(days));
+    std::tm& tm = tms[i];
+    tm = {};
+    tm.tm_year = date.year - 1900;
+    tm.tm_mon  = int(date.month) - 1;
+    tm.tm_mday = int(date.day);
+    tm.tm_wday = int((benjoffe_fast64::weekday(int32_t(days)) + 1) % 7);
+    tm.tm_yday = int(days - benjoffe_fast64::to_year_start(int32_t(days)));
+    tm.tm_hour = int(secs / 3600);
+    tm.tm_min  = int(secs / 60 % 60);
+    tm.tm_sec  = int(secs % 60);
+  }
+  return tms;
+}();
+
+void scan(benchmark::State& state) {
+  for (auto _ : state)
+    for (int64_t t : seconds)
+      benchmark::DoNotOptimize(t);
+}
+
+BENCHMARK(scan);
+
+#if !defined(_WIN32)
+
+void gmtime_strftime(benchmark::State& state, char const* format) {
+  char out[64];
+  for (auto _ : state) {
+    for (int64_t t : seconds) {
+      std::time_t const time = std::time_t(t);
+      std::tm tm;
+      ::gmtime_r(&time, &tm);
+      benchmark::DoNotOptimize(std::strftime(out, sizeof(out), format, &tm));
+      benchmark::ClobberMemory();
+    }
+  }
+}
+
+#endif // !defined(_WIN32)
+
+void strftime_tm(benchmark::State& state, char const* format) {
+  char out[64];
+  for (auto _ : state) {
+    for (std::tm const& tm : tms) {
+      benchmark::DoNotOptimize(std::strftime(out, sizeof(out), format, &tm));
+      benchmark::ClobberMemory();
+    }
+  }
+}
+
+void strftime_format_batch(benchmark::State& state, char const* format) {
+  ::strftime_format const f(format);
+  std::vector<char>   out(seconds.size() * f.max_size());
+  std::vector<size_t> ends(seconds.size());
+  for (auto _ : state) {
+    f.format(seconds.data(), seconds.size(), out.data(), ends.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+#if !defined(_WIN32)
+BENCHMARK_CAPTURE(gmtime_strftime, date, "%Y-%m-%d");
+#endif
+BENCHMARK_CAPTURE(strftime_tm, date, "%Y-%m-%d");
+BENCHMARK_CAPTURE(strftime_format_batch, date, "%Y-%m-%d");
+
+#if !defined(_WIN32)
+BENCHMARK_CAPTURE(gmtime_strftime, date_time, "%d/%m/%Y %H:%M");
+#endif
+BENCHMARK_CAPTURE(strftime_tm, date_time, "%d/%m/%Y %H:%M");
+BENCHMARK_CAPTURE(strftime_format_batch, date_time, "%d/%m/%Y %H:%M");
+
+#if !defined(_WIN32)
+BENCHMARK_CAPTURE(gmtime_strftime, rfc_date, "%a, %d %b %Y");
+#endif
+BENCHMARK_CAPTURE(strftime_tm, rfc_date, "%a, %d %b %Y");
+BENCHMARK_CAPTURE(strftime_format_batch, rfc_date, "%a, %d %b %Y");
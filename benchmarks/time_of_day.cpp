@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file time_of_day.cpp
+ *
+ * @brief Command line program that benchmarks the batch splitting of seconds
+ * and milliseconds of day into hour, minute, second (and millisecond) by
+ * time_of_day against plain division.
+ *
+ * The build adds -mavx2 where the host runs AVX2 (8 lanes of 32 bits per
+ * register), and builds it again as time_of_day_avx512 with -mavx512f where
+ * the host runs AVX-512 (16 lanes).
+ */
+
+#include "util/time_of_day.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+size_t constexpr count = 16384;
+
+auto random_column(uint32_t const n) {
+  std::uniform_int_distribution<uint32_t> uniform_dist(0, n - 1);
+  std::mt19937 rng;
+  std::vector<uint32_t> ns(count);
+  for (uint32_t& x : ns)
+    x = uniform_dist(rng);
+  return ns;
+}
+
+auto const seconds      = random_column(86400);
+auto const milliseconds = random_column(86400000);
+
+// Quotients and remainders by the compiler, which uses the same kind of
+// mul-shifts but derived for all uint32_t inputs.
+struct division {
+
+  static inline
+  void from_seconds(uint32_t const* seconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      uint32_t const n = seconds[i];
+      hours[i]   = uint8_t(n / 3600);
+      minutes[i] = uint8_t(n / 60 % 60);
+      secs[i]    = uint8_t(n % 60);
+    }
+  }
+
+  static inline
+  void from_milliseconds(uint32_t const* milliseconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs, uint16_t* millis, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      uint32_t const n = milliseconds[i];
+      hours[i]   = uint8_t(n / 3600000);
+      minutes[i] = uint8_t(n / 60000 % 60);
+      secs[i]    = uint8_t(n / 1000 % 60);
+      millis[i]  = uint16_t(n % 1000);
+    }
+  }
+};
+
+template <typename A>
+void from_seconds(benchmark::State& state) {
+  std::vector<uint8_t> hours(count), minutes(count), secs(count);
+  for (auto _ : state) {
+    A::from_seconds(seconds.data(), hours.data(), minutes.data(),
+      secs.data(), count);
+    benchmark::DoNotOptimize(hours.data());
+    benchmark::DoNotOptimize(minutes.data());
+    benchmark::DoNotOptimize(secs.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename A>
+void from_milliseconds(benchmark::State& state) {
+  std::vector<uint8_t>  hours(count), minutes(count), secs(count);
+  std::vector<uint16_t> millis(count);
+  for (auto _ : state) {
+    A::from_milliseconds(milliseconds.data(), hours.data(), minutes.data(),
+      secs.data(), millis.data(), count);
+    benchmark::DoNotOptimize(hours.data());
+    benchmark::DoNotOptimize(minutes.data());
+    benchmark::DoNotOptimize(secs.data());
+    benchmark::DoNotOptimize(millis.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(from_seconds<division         >);
+BENCHMARK(from_seconds<time_of_day      >);
+BENCHMARK(from_milliseconds<division    >);
+BENCHMARK(from_milliseconds<time_of_day >);
@@ -13,6 +13,7 @@
  *     Application to Calendar Algorithms" (2022).
  */
 
+#include "algorithms/abseil.hpp"
 #include "algorithms/baum.hpp"
 #include "algorithms/benjoffe_fast64.hpp"
 #include "algorithms/benjoffe_fast32.hpp"
@@ -24,15 +25,25 @@
 #include "algorithms/boost.hpp"
 #include "algorithms/boost_benjoffe_1.hpp"
 #include "algorithms/boost_benjoffe_2.hpp"
+#include "algorithms/cpython.hpp"
 #include "algorithms/dotnet.hpp"
+#include "algorithms/duckdb.hpp"
 #include "algorithms/fliegel_flandern.hpp"
 #include "algorithms/glibc.hpp"
+#include "algorithms/go.hpp"
 #include "algorithms/hatcher.hpp"
+#include "algorithms/hinnant.hpp"
+#include "algorithms/icu.hpp"
 #include "algorithms/libcxx.hpp"
+#include "algorithms/musl.hpp"
 #include "algorithms/neri_schneider.hpp"
 #include "algorithms/neri_schneider_eras.hpp"
 #include "algorithms/openjdk.hpp"
+#include "algorithms/postgresql.hpp"
 #include "algorithms/reingold_dershowitz.hpp"
+#include "algorithms/rust_chrono.hpp"
+#include "algorithms/sqlite.hpp"
+#include "algorithms/v8.hpp"
 #include "eaf/date.hpp"
 
 #include <benchmark/benchmark.h>
@@ -79,21 +90,40 @@ BENCHMARK(time<scan                  >);
 BENCHMARK(time<boost                 >);
 BENCHMARK(time<neri_schneider        >);
 BENCHMARK(time<benjoffe_fast64       >);
+BENCHMARK(time<benjoffe_fast64_x86   >);
+BENCHMARK(time<benjoffe_fast64_arm   >);
+BENCHMARK(time<benjoffe_fast64_x86_scale1>);
+BENCHMARK(time<benjoffe_fast64_arm_scale32>);
 BENCHMARK(time<benjoffe_fast32       >);
+BENCHMARK(time<benjoffe_fast32_x86   >);
+BENCHMARK(time<benjoffe_fast32_arm   >);
 BENCHMARK(time<benjoffe_fast32_wide  >);
+BENCHMARK(time<benjoffe_fast32_wide_x86>);
+BENCHMARK(time<benjoffe_fast32_wide_arm>);
 BENCHMARK(time<benjoffe_ordinal_alternative>);
 BENCHMARK(time<benjoffe_article_1    >);
 BENCHMARK(time<benjoffe_article_2    >);
 BENCHMARK(time<benjoffe_article_2_l1 >);
+BENCHMARK(time<abseil                >);
 BENCHMARK(time<baum                  >);
 BENCHMARK(time<boost_benjoffe_1      >);
 BENCHMARK(time<boost_benjoffe_2      >);
+BENCHMARK(time<cpython               >);
 BENCHMARK(time<dotnet                >);
+BENCHMARK(time<duckdb                >);
 BENCHMARK(time<fliegel_flandern      >);
 BENCHMARK(time<glibc                 >);
+BENCHMARK(time<go                    >);
 BENCHMARK(time<hatcher               >);
+BENCHMARK(time<hinnant               >);
+BENCHMARK(time<icu                   >);
 BENCHMARK(time<libcxx                >);
+BENCHMARK(time<musl                  >);
 BENCHMARK(time<neri_schneider        >);
 BENCHMARK(time<neri_schneider_eras   >);
 BENCHMARK(time<openjdk               >);
+BENCHMARK(time<postgresql            >);
 BENCHMARK(time<reingold_dershowitz   >);
+BENCHMARK(time<rust_chrono           >);
+BENCHMARK(time<sqlite                >);
+BENCHMARK(time<v8                    >);
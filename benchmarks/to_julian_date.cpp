@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file to_julian_date.cpp
+ *
+ * @brief Command line program that benchmarks implementations of to_date()
+ * on the proleptic Julian calendar.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/julian_fast32.hpp"
+#include "algorithms/julian_fast64.hpp"
+#include "algorithms/julian_gregorian.hpp"
+#include "eaf/date.hpp"
+#include "eaf/julian.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+auto const rata_dies = [](){
+  // The interval [-146097, 146097[ covers dates from 1 January 1570
+  // (inclusive) to 1 January 2370 (exclusive), that is, an interval of 800
+  // years centered at 1 January 1970 (Unix epoch).
+  std::uniform_int_distribution<int32_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+auto const historical_rata_dies = [](){
+  // 800 years centered at the Gregorian reform in Rome, so that half of
+  // the dates are Julian.
+  int32_t const changeover = julian_gregorian::rome;
+  std::uniform_int_distribution<int32_t> uniform_dist(changeover - 146097,
+    changeover + 146096);
+  std::mt19937 rng;
+  std::array<int32_t, 16384> ns;
+  for (int32_t& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+struct scan {};
+
+// Textbook EAF algorithm from the paper, shifted to the Unix epoch.
+struct julian_eaf {
+
+  // Days from 1 March 0000 of the Julian calendar to 1 January 1970 of the
+  // Gregorian calendar.
+  static int32_t constexpr epoch = 719470;
+
+  static inline
+  date32_t to_date(int32_t rata_die) {
+    return ::eaf::julian::to_date(rata_die + epoch);
+  }
+};
+
+// Historical dates by chaining two scalar calls plus a comparison.
+struct historical_naive {
+
+  static inline
+  date32_t to_date(int32_t rata_die) {
+    if (rata_die < julian_gregorian::rome)
+      return julian_eaf::to_date(rata_die);
+    return benjoffe_fast64::to_date(rata_die);
+  }
+};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (int32_t rata_die : rata_dies)
+      benchmark::DoNotOptimize(rata_die);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int32_t rata_die : rata_dies) {
+      date32_t date = A::to_date(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+}
+
+BENCHMARK(time<scan          >);
+BENCHMARK(time<julian_eaf    >);
+BENCHMARK(time<julian_fast32 >);
+BENCHMARK(time<julian_fast64 >);
+
+template <typename A>
+void time_historical(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int32_t rata_die : historical_rata_dies) {
+      date32_t date = A::to_date(rata_die);
+      benchmark::DoNotOptimize(date);
+    }
+  }
+}
+
+// Historical dates by the branch-light batch converter, on the native, x86
+// and ARM code paths.
+template <typename A>
+void time_historical_batch(benchmark::State& state) {
+  std::array<date32_t, historical_rata_dies.size()> dates;
+  for (auto _ : state) {
+    A::to_date(historical_rata_dies.data(), dates.data(),
+      historical_rata_dies.size(), julian_gregorian::rome);
+    benchmark::DoNotOptimize(dates.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(time_historical<historical_naive>);
+BENCHMARK(time_historical_batch<julian_gregorian    >);
+BENCHMARK(time_historical_batch<julian_gregorian_x86>);
+BENCHMARK(time_historical_batch<julian_gregorian_arm>);
@@ -14,17 +14,28 @@
  *     Application to Calendar Algorithms" (2022).
  */
 
+#include "algorithms/abseil.hpp"
 #include "algorithms/baum.hpp"
 #include "algorithms/boost.hpp"
+#include "algorithms/cpython.hpp"
 #include "algorithms/dotnet.hpp"
+#include "algorithms/duckdb.hpp"
 #include "algorithms/fliegel_flandern.hpp"
 #include "algorithms/glibc.hpp"
+#include "algorithms/go.hpp"
 #include "algorithms/hatcher.hpp"
+#include "algorithms/hinnant.hpp"
+#include "algorithms/icu.hpp"
 #include "algorithms/benjoffe_fast64.hpp"
 #include "algorithms/libcxx.hpp"
+#include "algorithms/musl.hpp"
 #include "algorithms/neri_schneider.hpp"
 #include "algorithms/openjdk.hpp"
+#include "algorithms/postgresql.hpp"
 #include "algorithms/reingold_dershowitz.hpp"
+#include "algorithms/rust_chrono.hpp"
+#include "algorithms/sqlite.hpp"
+#include "algorithms/v8.hpp"
 #include "eaf/date.hpp"
 
 #include <benchmark/benchmark.h>
@@ -68,14 +79,25 @@ void time(benchmark::State& state) {
 }
 
 BENCHMARK(time<scan                >);
+BENCHMARK(time<abseil              >);
 BENCHMARK(time<baum                >);
 BENCHMARK(time<boost               >);
+BENCHMARK(time<cpython             >);
 BENCHMARK(time<dotnet              >);
+BENCHMARK(time<duckdb              >);
 BENCHMARK(time<fliegel_flandern    >);
 BENCHMARK(time<glibc               >);
+BENCHMARK(time<go                  >);
 BENCHMARK(time<hatcher             >);
+BENCHMARK(time<hinnant             >);
+BENCHMARK(time<icu                 >);
 BENCHMARK(time<benjoffe_fast64     >);
 BENCHMARK(time<libcxx              >);
+BENCHMARK(time<musl                >);
 BENCHMARK(time<openjdk             >);
+BENCHMARK(time<postgresql          >);
 BENCHMARK(time<reingold_dershowitz >);
+BENCHMARK(time<rust_chrono         >);
+BENCHMARK(time<sqlite              >);
+BENCHMARK(time<v8                  >);
 BENCHMARK(time<neri_schneider      >);
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file to_tm.cpp
+ *
+ * @brief Command line program that benchmarks conversions of seconds since
+ * 1 January 1970 to struct tm, as gmtime_r does.
+ *
+ * musl's __secs_to_tm works on seconds. The other algorithms work on days
+ * and are given the same job: a floor division by 86400, to_date, and the
+ * time, weekday and day of year fields that __secs_to_tm also fills.
+ */
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/hinnant.hpp"
+#include "algorithms/musl.hpp"
+#include "algorithms/neri_schneider.hpp"
+#include "eaf/date.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <random>
+
+auto const seconds = [](){
+  // 800 years centered at 1 January 1970, as to_date, with random times of
+  // day.
+  std::uniform_int_distribution<int64_t> uniform_dist(-146097 * 86400ll,
+    146097 * 86400ll - 1);
+  std::mt19937 rng;
+  std::array<int64_t, 16384> ts;
+  for (int64_t& t : ts)
+    t = uniform_dist(rng);
+  return ts;
+}();
+
+// Days before each month in common years.
+uint32_t constexpr days_before[] = {
+  0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+template <typename A>
+struct days_to_tm {
+  static int to_tm(int64_t t, std::tm* tm) {
+    int64_t const days = t / 86400 - (t % 86400 < 0);
+    int32_t const secs = int32_t(t - days * 86400);
+    date32_t const date = A::to_date(int32_t(days));
+    bool const leap = date.year % 4 == 0 &&
+      (date.year % 100 != 0 || date.year % 400 == 0);
+    tm->tm_year = date.year - 1900;
+    tm->tm_mon  = int(date.month) - 1;
+    tm->tm_mday = int(date.day);
+    tm->tm_wday = int((benjoffe_fast64::weekday(int32_t(days)) + 1) % 7);
+    tm->tm_yday = int(days_before[date.month - 1] + date.day - 1 +
+      (leap && date.month > 2));
+    tm->tm_hour = secs / 3600;
+    tm->tm_min  = secs / 60 % 60;
+    tm->tm_sec  = secs % 60;
+    return 0;
+  }
+};
+
+struct scan {};
+
+struct musl_to_tm {
+  static int to_tm(int64_t t, std::tm* tm) {
+    return musl::secs_to_tm(t, tm);
+  }
+};
+
+template <typename A>
+void time(benchmark::State& state);
+
+template <>
+void time<scan>(benchmark::State& state) {
+  for (auto _ : state)
+    for (int64_t t : seconds)
+      benchmark::DoNotOptimize(t);
+}
+
+template <typename A>
+void time(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int64_t t : seconds) {
+      std::tm tm;
+      A::to_tm(t, &tm);
+      benchmark::DoNotOptimize(tm);
+    }
+  }
+}
+
+BENCHMARK(time<scan                         >);
+BENCHMARK(time<musl_to_tm                   >);
+BENCHMARK(time<days_to_tm<hinnant>          >);
+BENCHMARK(time<days_to_tm<neri_schneider>   >);
+BENCHMARK(time<days_to_tm<benjoffe_fast64>  >);
+BENCHMARK(time<days_to_tm<benjoffe_fast32>  >);
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file tzif.cpp
+ *
+ * @brief Command line program that benchmarks conversions of UTC seconds to
+ * local broken-down time by a TZif file: tzif against localtime_r with TZ
+ * set to the file's path, on unsorted and sorted rows.
+ *
+ * The file is tests/data/tzif/Europe_Berlin. localtime_r is not timed on
+ * Windows, which lacks it.
+ */
+
+#include "util/tzif.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <string>
+
+std::string const path = std::string(EAF_TZIF_DIR) + "/Europe_Berlin";
+
+auto const unsorted = [](){
+  // 1900 to 2100, across the transitions of the file (1893 to 2037) and
+  // its footer's rules.
+  std::uniform_int_distribution<int64_t> uniform_dist(-2208988800,
+    4133980799);
+  std::mt19937 rng;
+  std::array<int64_t, 16384> ts;
+  for (int64_t& t : ts)
+    t = uniform_dist(rng);
+  return ts;
+}();
+
+auto const sorted = [](){
+  auto ts = unsorted;
+  std::sort(ts.begin(), ts.end());
+  return ts;
+}();
+
+tzif const tz(path);
+
+struct scan {};
+
+#if !defined(_WIN32)
+
+template <typename T>
+void localtime_r(benchmark::State& state, T const& ts) {
+  std::string const tz_path = ":" + path;
+  setenv("TZ", tz_path.c_str(), 1);
+  tzset();
+  for (auto _ : state) {
+    for (int64_t t : ts) {
+      std::time_t const time = std::time_t(t);
+      std::tm tm;
+      ::localtime_r(&time, &tm);
+      benchmark::DoNotOptimize(tm);
+    }
+  }
+}
+
+#endif // !defined(_WIN32)
+
+template <typename T>
+void tzif_scan(benchmark::State& state, T const& ts) {
+  for (auto _ : state)
+    for (int64_t t : ts)
+      benchmark::DoNotOptimize(t);
+}
+
+void tzif_unsorted(benchmark::State& state) {
+  std::array<local_time_t, unsorted.size()> local;
+  for (auto _ : state) {
+    tz.to_local_time(unsorted.data(), local.data(), unsorted.size());
+    benchmark::DoNotOptimize(local.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void tzif_sorted(benchmark::State& state) {
+  std::array<local_time_t, sorted.size()> local;
+  for (auto _ : state) {
+    tz.to_local_time_sorted(sorted.data(), local.data(), sorted.size());
+    benchmark::DoNotOptimize(local.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK_CAPTURE(tzif_scan, unsorted, unsorted);
+#if !defined(_WIN32)
+BENCHMARK_CAPTURE(localtime_r, unsorted, unsorted);
+BENCHMARK_CAPTURE(localtime_r, sorted, sorted);
+#endif
+BENCHMARK(tzif_unsorted);
+BENCHMARK(tzif_sorted);
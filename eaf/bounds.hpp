@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file bounds.hpp
+ *
+ * @brief Policies for inputs outside the range of calendar algorithms.
+ *
+ * A policy has a static member function
+ *
+ *     template <typename T> T check(T x, T min, T max);
+ *
+ * called on the input, where T is the rata die or date type, which returns
+ * the value to be converted, and a static data member is_noexcept. Checks
+ * compile to nothing with unchecked, and to nothing for algorithms whose
+ * range is the whole input type, e.g., benjoffe_fast64::to_date.
+ */
+
+#ifndef EAF_EAF_BOUNDS_HPP
+#define EAF_EAF_BOUNDS_HPP
+
+#include "eaf/date.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace eaf {
+namespace bounds {
+
+/**
+ * @brief No check. (Out-of-range inputs have undefined results.)
+ */
+struct unchecked {
+
+  static bool constexpr is_noexcept = true;
+
+  template <typename T>
+  static T constexpr check(T const x, T const, T const) noexcept {
+    return x;
+  }
+};
+
+/**
+ * @brief Checks with assert, i.e., only when NDEBUG is not defined.
+ */
+struct assertion {
+
+  static bool constexpr is_noexcept = true;
+
+  template <typename T>
+  static T constexpr check(T const x, T const min, T const max) noexcept {
+    assert(!(x < min) && !(max < x) && "Input is out of bounds.");
+    (void) min; (void) max;
+    return x;
+  }
+};
+
+/**
+ * @brief Clamps the input to the range.
+ */
+struct saturate {
+
+  static bool constexpr is_noexcept = true;
+
+  template <typename T>
+  static T constexpr check(T const x, T const min, T const max) noexcept {
+    return x < min ? min : max < x ? max : x;
+  }
+};
+
+/**
+ * @brief Raises a sticky, thread-local flag, similar to floating-point
+ * exception flags. The flag is only written when raised.
+ */
+struct error_flag {
+
+  static bool constexpr is_noexcept = true;
+
+  static inline thread_local bool raised = false;
+
+  template <typename T>
+  static T check(T const x, T const min, T const max) noexcept {
+    if (x < min || max < x)
+      raised = true;
+    return x;
+  }
+};
+
+/**
+ * @brief Throws std::out_of_range.
+ */
+struct exception {
+
+  static bool constexpr is_noexcept = false;
+
+  template <typename T>
+  static T check(T const x, T const min, T const max) {
+    if (x < min || max < x)
+      throw std::out_of_range("Input is out of bounds.");
+    return x;
+  }
+};
+
+/**
+ * @brief Batch to_date reporting out-of-range lanes.
+ *
+ * Bit i % 64 of out_of_range[i / 64] is set if, and only if, rata_dies[i]
+ * is out of range, in which case dates[i] is unspecified. The check is
+ * branchless and the conversion is done for every lane, hence A should be
+ * an algorithm with the unchecked policy and defined (if wrong) results out
+ * of range, e.g., benjoffe_fast32.
+ *
+ * @tparam A        Algorithm with static members rata_die_min and
+ *                  rata_die_max.
+ */
+template <typename A>
+void
+to_date(int32_t const* rata_dies, date32_t* dates, size_t count,
+  uint64_t* out_of_range) {
+
+  for (size_t i = 0; i < count; i += 64) {
+    size_t   const end  = count - i < 64 ? count - i : 64;
+    uint64_t       mask = 0;
+    for (size_t j = 0; j < end; ++j) {
+      int32_t const n = rata_dies[i + j];
+      mask |= uint64_t(n < A::rata_die_min || A::rata_die_max < n) << j;
+      dates[i + j] = A::to_date(n);
+    }
+    out_of_range[i / 64] = mask;
+  }
+}
+
+/**
+ * @brief Batch to_rata_die reporting out-of-range lanes, see to_date above.
+ *
+ * @tparam A        Algorithm with static members date_min and date_max.
+ */
+template <typename A>
+void
+to_rata_die(date32_t const* dates, int32_t* rata_dies, size_t count,
+  uint64_t* out_of_range) {
+
+  // Dates compare as (year, month, day) keys with month and day taking 4 and
+  // 5 bits, respectively.
+  auto const key = [](date32_t const date) {
+    return int64_t(date.year) * 512 + date.month * 32 + date.day;
+  };
+  int64_t const key_min = key(A::date_min);
+  int64_t const key_max = key(A::date_max);
+
+  for (size_t i = 0; i < count; i += 64) {
+    size_t   const end  = count - i < 64 ? count - i : 64;
+    uint64_t       mask = 0;
+    for (size_t j = 0; j < end; ++j) {
+      date32_t const date = dates[i + j];
+      int64_t  const k    = key(date);
+      mask |= uint64_t(k < key_min || key_max < k) << j;
+      rata_dies[i + j] = A::to_rata_die(date.year, date.month, date.day);
+    }
+    out_of_range[i / 64] = mask;
+  }
+}
+
+} // namespace bounds
+} // namespace eaf
+
+#endif // EAF_EAF_BOUNDS_HPP
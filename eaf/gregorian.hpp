@@ -17,11 +17,11 @@
 #define EAF_GREGORIAN_HPP
 
 #include "eaf/common.hpp"
+#include "eaf/bounds.hpp"
 #include "eaf/limits.hpp"
 
 #include <cstdint>
 #include <limits>
-#include <iostream>
 
 namespace eaf {
 namespace gregorian {
@@ -32,18 +32,17 @@ namespace gregorian {
  * The epoch is 1 March 0000 of the proleptic Gregorian calendar.
  *
  * @tparam T        Year and rata die type.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param N         The rata die.
  *
  * @return The proleptic Gregorian date.
  */
-template <typename T>
+template <typename T, typename Bounds = bounds::assertion>
 date_t<T> constexpr
-to_date(T N) noexcept {
+to_date(T N) noexcept(Bounds::is_noexcept) {
 
-  if (N < limits<T>::rata_die_min || limits<T>::rata_die_max < N)
-    std::cout << "WARNING: Rata die is out of bounds. (The code has "
-      "undefined behaviour.)\n";
+  N = Bounds::check(N, limits<T>::rata_die_min, limits<T>::rata_die_max);
 
   // Century.
   T        const N_1 = 4 * N + 3;
@@ -76,6 +75,7 @@ to_date(T N) noexcept {
  * The epoch is 1 March 0000 of the proleptic Gregorian calendar.
  *
  * @tparam T        Year and rata die type.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param Y_G       The year.
  * @param M_G       The month.
@@ -83,14 +83,16 @@ to_date(T N) noexcept {
  *
  * @return The rata die.
  */
-template <typename T>
+template <typename T, typename Bounds = bounds::assertion>
 T constexpr
-to_rata_die(T Y_G, uint32_t M_G, uint32_t D_G) noexcept {
+to_rata_die(T Y_G, uint32_t M_G, uint32_t D_G)
+  noexcept(Bounds::is_noexcept) {
 
-  date_t<T> const date = { Y_G, M_G, D_G };
-  if (date < limits<T>::date_min || limits<T>::date_max < date)
-    std::cout << "WARNING: Date is out of bounds. (The code has undefined "
-      "behaviour.)\n";
+  date_t<T> const date = Bounds::check(date_t<T>{ Y_G, M_G, D_G },
+    limits<T>::date_min, limits<T>::date_max);
+  Y_G = date.year;
+  M_G = date.month;
+  D_G = date.day;
 
   // Map.
   uint32_t const J = M_G <= 2;
@@ -116,19 +118,19 @@ to_rata_die(T Y_G, uint32_t M_G, uint32_t D_G) noexcept {
  * @tparam T        Year and rata die type.
  * @tparam epoch    The epoch shift (e.g., 719468 for Unix epoch).
  * @tparam s        Cycles shift.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param N         The rata die.
  *
  * @return The proleptic Gregorian date.
  */
-template <typename T, T epoch = 0, T s = 0>
+template <typename T, T epoch = 0, T s = 0,
+  typename Bounds = bounds::assertion>
 date_t<T> constexpr
-to_date_opt(T N_U) noexcept {
+to_date_opt(T N_U) noexcept(Bounds::is_noexcept) {
 
-  if (N_U < limits_gregorian_opt<T, epoch, s>::rata_die_min ||
-      limits_gregorian_opt<T, epoch, s>::rata_die_max < N_U)
-    std::cout << "WARNING: Rata die is out of bounds. (The code has "
-      "undefined behaviour.)\n";
+  using limits_t = limits_gregorian_opt<T, epoch, s>;
+  N_U = Bounds::check(N_U, limits_t::rata_die_min, limits_t::rata_die_max);
 
   using uint_t = typename std::make_unsigned<T>::type;
 
@@ -174,6 +176,7 @@ to_date_opt(T N_U) noexcept {
  * @tparam T        Year and rata die type.
  * @tparam epoch    The epoch shift (e.g., 719468 for Unix epoch).
  * @tparam s        Cycles shift.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param Y_G       The year.
  * @param M_G       The month.
@@ -181,15 +184,18 @@ to_date_opt(T N_U) noexcept {
  *
  * @return The rata die.
  */
-template <typename T, T epoch = 0, T s = 0>
+template <typename T, T epoch = 0, T s = 0,
+  typename Bounds = bounds::assertion>
 T constexpr
-to_rata_die_opt(T Y_G, uint32_t M_G, uint32_t D_G) noexcept {
-
-  date_t<T> const date = { Y_G, M_G, D_G };
-  if (date < limits_gregorian_opt<T, epoch, s>::date_min ||
-      limits_gregorian_opt<T, epoch, s>::date_max < date)
-    std::cout << "WARNING: Date is out of bounds. (The code has undefined "
-      "behaviour.)\n";
+to_rata_die_opt(T Y_G, uint32_t M_G, uint32_t D_G)
+  noexcept(Bounds::is_noexcept) {
+
+  using limits_t = limits_gregorian_opt<T, epoch, s>;
+  date_t<T> const date = Bounds::check(date_t<T>{ Y_G, M_G, D_G },
+    limits_t::date_min, limits_t::date_max);
+  Y_G = date.year;
+  M_G = date.month;
+  D_G = date.day;
 
   using uint_t = typename std::make_unsigned<T>::type;
 
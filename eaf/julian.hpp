@@ -17,11 +17,11 @@
 #define EAF_EAF_JULIAN_HPP
 
 #include "eaf/common.hpp"
+#include "eaf/bounds.hpp"
 #include "eaf/limits.hpp"
 
 #include <cstdint>
 #include <limits>
-#include <iostream>
 
 namespace eaf {
 namespace julian {
@@ -32,18 +32,17 @@ namespace julian {
  * The epoch is 1 March 0000 of the proleptic Julian calendar.
  *
  * @tparam T        Year and rata die type.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param N         The rata die.
  *
  * @return The proleptic Julian date.
  */
-template <typename T>
+template <typename T, typename Bounds = bounds::assertion>
 date_t<T> constexpr
-to_date(T N) noexcept {
+to_date(T N) noexcept(Bounds::is_noexcept) {
 
-  if (N < limits<T>::rata_die_min || limits<T>::rata_die_max < N)
-    std::cout << "WARNING: Rata die is out of bounds. (The code has "
-      "undefined behaviour.)\n";
+  N = Bounds::check(N, limits<T>::rata_die_min, limits<T>::rata_die_max);
 
   // Year.
   T        const N_1 = 4 * N + 3;
@@ -70,6 +69,7 @@ to_date(T N) noexcept {
  * The epoch is 1 March 0000 of the proleptic Julian calendar.
  *
  * @tparam T        Year and rata die type.
+ * @tparam Bounds   Bounds policy (see eaf/bounds.hpp.)
  *
  * @param Y_J       The year.
  * @param M_J       The month.
@@ -77,14 +77,16 @@ to_date(T N) noexcept {
  *
  * @return The proleptic Julian date.
  */
-template <typename T>
+template <typename T, typename Bounds = bounds::assertion>
 T constexpr
-to_rata_die(T Y_J, uint32_t M_J, uint32_t D_J) noexcept {
-
-  date_t<T> const date = { Y_J, M_J, D_J };
-  if (date < limits<T>::date_min || limits<T>::date_max < date)
-    std::cout << "WARNING: Date is out of bounds. (The code has undefined "
-      "behaviour.)\n";
+to_rata_die(T Y_J, uint32_t M_J, uint32_t D_J)
+  noexcept(Bounds::is_noexcept) {
+
+  date_t<T> const date = Bounds::check(date_t<T>{ Y_J, M_J, D_J },
+    limits<T>::date_min, limits<T>::date_max);
+  Y_J = date.year;
+  M_J = date.month;
+  D_J = date.day;
 
   // Map.
   uint32_t const J = M_J <= 2;
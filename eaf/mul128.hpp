@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file mul128.hpp
+ *
+ * @brief Policies for the 64 x 64 -> 128-bit multiplications of the 64-bit
+ * algorithms.
+ *
+ * A policy has static member functions
+ *
+ *     uint64_t mul (uint64_t a, uint64_t b, uint64_t* hi); // returns low
+ *     uint64_t mulh(uint64_t a, uint64_t b);               // high only
+ *
+ * (mirroring MSVC's _umul128 and __umulh). Algorithms call mulh when they
+ * only need the high half, so that a backend may skip the low product.
+ */
+
+#ifndef EAF_EAF_MUL128_HPP
+#define EAF_EAF_MUL128_HPP
+
+#include "algorithms/_portable_uint128.hpp"
+
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace eaf {
+namespace mul128 {
+
+/**
+ * @brief uint128_t of _portable_uint128.hpp: unsigned __int128 on GCC and
+ * Clang, _umul128 or __umulh on MSVC.
+ */
+struct native {
+
+  static inline
+  uint64_t mul(uint64_t const a, uint64_t const b, uint64_t* const hi) {
+    uint128_t const p = uint128_t(a) * b;
+    *hi = uint64_t(p >> 64);
+    return uint64_t(p);
+  }
+
+  static inline
+  uint64_t mulh(uint64_t const a, uint64_t const b) {
+    return uint64_t(uint128_t(a) * b >> 64);
+  }
+
+}; // struct native
+
+#if defined(__BMI2__)
+
+/**
+ * @brief BMI2's _mulx_u64 intrinsic (x86-64 built with, e.g., -mbmi2).
+ */
+struct mulx {
+
+  static inline
+  uint64_t mul(uint64_t const a, uint64_t const b, uint64_t* const hi) {
+    unsigned long long h;
+    uint64_t const lo = _mulx_u64(a, b, &h);
+    *hi = h;
+    return lo;
+  }
+
+  static inline
+  uint64_t mulh(uint64_t const a, uint64_t const b) {
+    unsigned long long h;
+    _mulx_u64(a, b, &h);
+    return h;
+  }
+
+}; // struct mulx
+
+#endif // defined(__BMI2__)
+
+/**
+ * @brief Four 32 x 32 -> 64-bit products, for targets without a 128-bit
+ * multiply.
+ */
+struct portable {
+
+  static inline
+  uint64_t mul(uint64_t const a, uint64_t const b, uint64_t* const hi) {
+    uint64_t const p00 = uint64_t(uint32_t(a)) * uint32_t(b);
+    uint64_t const p01 = uint64_t(uint32_t(a)) * (b >> 32);
+    uint64_t const p10 = (a >> 32) * uint32_t(b);
+    uint64_t const p11 = (a >> 32) * (b >> 32);
+    uint64_t const mid = (p00 >> 32) + uint32_t(p01) + uint32_t(p10);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return mid << 32 | uint32_t(p00);
+  }
+
+  static inline
+  uint64_t mulh(uint64_t const a, uint64_t const b) {
+    uint64_t hi;
+    mul(a, b, &hi);
+    return hi;
+  }
+
+}; // struct portable
+
+} // namespace mul128
+} // namespace eaf
+
+#endif // EAF_EAF_MUL128_HPP
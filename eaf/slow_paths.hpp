@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file slow_paths.hpp
+ *
+ * @brief Opt-in counters of the data-dependent slow paths of competitor
+ * algorithms, e.g., the year correction loop of glibc::to_date.
+ *
+ * Algorithms mark a slow path with EAF_SLOW_PATH(path), which compiles to
+ * nothing unless EAF_COUNT_SLOW_PATHS is defined, in which case it
+ * increments slow_paths::counters[path]. Counters are not atomic.
+ */
+
+#ifndef EAF_EAF_SLOW_PATHS_HPP
+#define EAF_EAF_SLOW_PATHS_HPP
+
+#include <cstdint>
+
+namespace eaf {
+
+struct slow_paths {
+
+  enum path_t {
+    glibc_year_loop,     // Iterations of the year guess loop in to_date
+    openjdk_doy_fix,     // Negative day of year estimate in to_date
+    firefox_year_dec,    // Year estimate one too high in YearFromTime,
+    firefox_year_inc,    // or too low (called thrice by to_date)
+    dotnet_month_loop,   // Iterations of the month scan in to_date
+    count
+  };
+
+  static char const* name(path_t path) {
+    char const* const names[] = { "glibc_year_loop", "openjdk_doy_fix",
+      "firefox_year_dec", "firefox_year_inc", "dotnet_month_loop" };
+    return names[path];
+  }
+
+  static inline uint64_t counters[count] = {};
+
+  static void reset() {
+    for (uint64_t& counter : counters)
+      counter = 0;
+  }
+};
+
+} // namespace eaf
+
+#ifdef EAF_COUNT_SLOW_PATHS
+#define EAF_SLOW_PATH(path) (++eaf::slow_paths::counters[eaf::slow_paths::path])
+#else
+#define EAF_SLOW_PATH(path) ((void) 0)
+#endif
+
+#endif // EAF_EAF_SLOW_PATHS_HPP
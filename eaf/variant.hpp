@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file variant.hpp
+ *
+ * @brief Policies selecting the code path of the benjoffe algorithms, which
+ * were tuned separately for x86 and ARM.
+ *
+ * A policy has static data members
+ *
+ *     bool late_bump;   // Jan/Feb from the month (ARM) or the year-part
+ *     uint32_t scale;   // SCALE of benjoffe_fast64 (other ignore it)
+ *
+ * The x86 path tests for January and February before finding the month, so
+ * the month needs no correction. The ARM path finds a March-based month and
+ * corrects it afterwards ("late bump"), which is a single conditional
+ * select on Apple Silicon, and uses smaller constants (SCALE = 1). All
+ * policies can be instantiated on any host; native is the one the host
+ * would have picked.
+ */
+
+#ifndef EAF_EAF_VARIANT_HPP
+#define EAF_EAF_VARIANT_HPP
+
+#include <cstdint>
+
+namespace eaf {
+namespace variant {
+
+template <bool LATE_BUMP, uint32_t SCALE>
+struct variant_t {
+  static bool     constexpr late_bump = LATE_BUMP;
+  static uint32_t constexpr scale     = SCALE;
+};
+
+using x86 = variant_t<false, 32>;
+using arm = variant_t<true, 1>;
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+using native = arm;
+#else
+using native = x86;
+#endif
+
+} // namespace variant
+} // namespace eaf
+
+#endif // EAF_EAF_VARIANT_HPP
@@ -16,6 +16,7 @@
 
 #include "tests/tests.hpp"
 
+#include "algorithms/abseil.hpp"
 #include "algorithms/baum.hpp"
 #include "algorithms/benjoffe_article_1.hpp"
 #include "algorithms/benjoffe_article_2.hpp"
@@ -27,15 +28,25 @@
 #include "algorithms/boost.hpp"
 #include "algorithms/boost_benjoffe_1.hpp"
 #include "algorithms/boost_benjoffe_2.hpp"
+#include "algorithms/cpython.hpp"
 #include "algorithms/dotnet.hpp"
+#include "algorithms/duckdb.hpp"
 #include "algorithms/fliegel_flandern.hpp"
 #include "algorithms/glibc.hpp"
+#include "algorithms/go.hpp"
 #include "algorithms/hatcher.hpp"
+#include "algorithms/hinnant.hpp"
+#include "algorithms/icu.hpp"
 #include "algorithms/libcxx.hpp"
+#include "algorithms/musl.hpp"
 #include "algorithms/neri_schneider.hpp"
 #include "algorithms/neri_schneider_eras.hpp"
 #include "algorithms/openjdk.hpp"
+#include "algorithms/postgresql.hpp"
 #include "algorithms/reingold_dershowitz.hpp"
+#include "algorithms/rust_chrono.hpp"
+#include "algorithms/sqlite.hpp"
+#include "algorithms/v8.hpp"
 #include "eaf/date.hpp"
 
 #include <gtest/gtest.h>
@@ -79,10 +90,19 @@ struct algorithm_tests : public ::testing::Test {
 }; // struct algorithm_tests
 
 using implementations = ::testing::Types<
+  abseil,
   baum,
   benjoffe_fast64,
+  benjoffe_fast64_x86,
+  benjoffe_fast64_arm,
+  benjoffe_fast64_x86_scale1,
+  benjoffe_fast64_arm_scale32,
   benjoffe_fast32,
+  benjoffe_fast32_x86,
+  benjoffe_fast32_arm,
   benjoffe_fast32_wide,
+  benjoffe_fast32_wide_x86,
+  benjoffe_fast32_wide_arm,
   benjoffe_ordinal_alternative,
   benjoffe_article_1,
   benjoffe_article_2,
@@ -90,15 +110,25 @@ using implementations = ::testing::Types<
   boost,
   boost_benjoffe_1,
   boost_benjoffe_2,
+  cpython,
   dotnet,
+  duckdb,
   fliegel_flandern,
   glibc,
+  go,
   hatcher,
+  hinnant,
+  icu,
   libcxx,
+  musl,
   neri_schneider,
   neri_schneider_eras,
   openjdk,
-  reingold_dershowitz
+  postgresql,
+  reingold_dershowitz,
+  rust_chrono,
+  sqlite,
+  v8
 >;
 
 // The extra comma below is to silent a warning.
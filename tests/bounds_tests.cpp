@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file bounds_tests.cpp
+ *
+ * @brief Command line program that tests the bounds policies of the eaf and
+ *   benjoffe algorithms and the batch conversions reporting out-of-range
+ *   lanes.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast32_wide.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/julian_fast32.hpp"
+#include "algorithms/julian_fast64.hpp"
+#include "algorithms_ordinal/ordinal_benjoffe_fast32.hpp"
+#include "eaf/bounds.hpp"
+#include "eaf/date.hpp"
+#include "eaf/gregorian.hpp"
+#include "eaf/julian.hpp"
+#include "eaf/limits.hpp"
+#include "util/epoch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+template <typename B>
+using fast32 = benjoffe_fast32_t<epoch::unix_time, B>;
+
+//--------------------------------------------------------------------------
+// Limits
+//--------------------------------------------------------------------------
+
+/**
+ * Tests whether date_min and date_max are the dates of rata_die_min and
+ * rata_die_max.
+ */
+TEST(bounds_tests, limits) {
+
+  EXPECT_EQ(benjoffe_fast64::to_date(benjoffe_fast64::rata_die_min),
+    benjoffe_fast64::date_min);
+  EXPECT_EQ(benjoffe_fast64::to_date(benjoffe_fast64::rata_die_max),
+    benjoffe_fast64::date_max);
+
+  EXPECT_EQ(benjoffe_fast32::to_date(benjoffe_fast32::rata_die_min),
+    benjoffe_fast32::date_min);
+  EXPECT_EQ(benjoffe_fast32::to_date(benjoffe_fast32::rata_die_max),
+    benjoffe_fast32::date_max);
+
+  EXPECT_EQ(benjoffe_fast32_mjd::to_date(benjoffe_fast32_mjd::rata_die_min),
+    benjoffe_fast32_mjd::date_min);
+  EXPECT_EQ(benjoffe_fast32_mjd::to_date(benjoffe_fast32_mjd::rata_die_max),
+    benjoffe_fast32_mjd::date_max);
+
+  EXPECT_EQ(benjoffe_fast32_wide::to_date(INT32_MIN),
+    benjoffe_fast32_wide::date_min);
+  EXPECT_EQ(benjoffe_fast32_wide::to_date(INT32_MAX),
+    benjoffe_fast32_wide::date_max);
+
+  EXPECT_EQ(julian_fast32::to_date(INT32_MIN), julian_fast32::date_min);
+  EXPECT_EQ(julian_fast32::to_date(INT32_MAX), julian_fast32::date_max);
+  EXPECT_EQ(julian_fast64::to_date(INT32_MIN), julian_fast64::date_min);
+  EXPECT_EQ(julian_fast64::to_date(INT32_MAX), julian_fast64::date_max);
+}
+
+/**
+ * Tests whether the x86 and ARM variants agree with each other on the
+ * limits and on 2^20 points spread over the input range. eaf_tests checks
+ * the 32-bit variants on every day of their ranges.
+ */
+TEST(bounds_tests, variants) {
+
+  auto const check = []<typename X, typename A>() {
+    EXPECT_EQ(A::rata_die_min, X::rata_die_min);
+    EXPECT_EQ(A::rata_die_max, X::rata_die_max);
+    EXPECT_EQ(X::to_date(X::rata_die_min), X::date_min);
+    EXPECT_EQ(X::to_date(X::rata_die_max), X::date_max);
+    int64_t const step = (int64_t(X::rata_die_max) - X::rata_die_min) /
+      (1 << 20);
+    for (int64_t n = X::rata_die_min; n <= X::rata_die_max; n += step)
+      ASSERT_EQ(A::to_date(int32_t(n)), X::to_date(int32_t(n))) <<
+        "Failed for rata_die = " << n;
+  };
+
+  check.template operator()<benjoffe_fast64_x86, benjoffe_fast64_arm>();
+  check.template operator()<benjoffe_fast64_x86, benjoffe_fast64_x86_scale1>();
+  check.template operator()<benjoffe_fast64_x86, benjoffe_fast64_arm_scale32>();
+  check.template operator()<benjoffe_fast32_x86, benjoffe_fast32_arm>();
+  check.template operator()<benjoffe_fast32_wide_x86,
+    benjoffe_fast32_wide_arm>();
+}
+
+//--------------------------------------------------------------------------
+// Policies
+//--------------------------------------------------------------------------
+
+int32_t static constexpr min = fast32<bounds::unchecked>::rata_die_min;
+int32_t static constexpr max = fast32<bounds::unchecked>::rata_die_max;
+
+/**
+ * Tests that in-range inputs are unaffected by any policy.
+ */
+TEST(bounds_tests, in_range) {
+
+  for (int32_t n : { min, -1, 0, 1, max }) {
+    date32_t const date = benjoffe_fast32::to_date(n);
+    EXPECT_EQ(fast32<bounds::assertion >::to_date(n), date);
+    EXPECT_EQ(fast32<bounds::saturate  >::to_date(n), date);
+    EXPECT_EQ(fast32<bounds::error_flag>::to_date(n), date);
+    EXPECT_EQ(fast32<bounds::exception >::to_date(n), date);
+
+    EXPECT_EQ(fast32<bounds::saturate  >::to_rata_die(date.year, date.month,
+      date.day), n);
+    EXPECT_EQ(fast32<bounds::exception >::to_rata_die(date.year, date.month,
+      date.day), n);
+  }
+  EXPECT_FALSE(bounds::error_flag::raised);
+}
+
+/**
+ * Tests that saturate clamps to the limits.
+ */
+TEST(bounds_tests, saturate) {
+
+  using A = fast32<bounds::saturate>;
+
+  EXPECT_EQ(A::to_date(min - 1), A::date_min);
+  EXPECT_EQ(A::to_date(INT32_MIN), A::date_min);
+  EXPECT_EQ(A::to_date(max + 1), A::date_max);
+  EXPECT_EQ(A::to_date(INT32_MAX), A::date_max);
+
+  EXPECT_EQ(A::to_rata_die(A::date_min.year - 1, 12, 31), min);
+  EXPECT_EQ(A::to_rata_die(A::date_max.year + 1, 1, 1), max);
+
+  date_t<int32_t> const date = gregorian::to_date<int32_t, bounds::saturate>(
+    INT32_MAX);
+  EXPECT_EQ(date, gregorian::to_date<int32_t>(
+    limits<int32_t>::rata_die_max));
+}
+
+/**
+ * Tests that error_flag is raised, sticky and does not change the result.
+ */
+TEST(bounds_tests, error_flag) {
+
+  using A = fast32<bounds::error_flag>;
+
+  bounds::error_flag::raised = false;
+  EXPECT_EQ(A::to_date(max + 1), benjoffe_fast32::to_date(max + 1));
+  EXPECT_TRUE(bounds::error_flag::raised);
+  A::to_date(0);
+  EXPECT_TRUE(bounds::error_flag::raised);
+
+  bounds::error_flag::raised = false;
+  A::to_rata_die(A::date_max.year + 1, 1, 1);
+  EXPECT_TRUE(bounds::error_flag::raised);
+
+  bounds::error_flag::raised = false;
+  julian::to_date<int32_t, bounds::error_flag>(INT32_MIN);
+  EXPECT_TRUE(bounds::error_flag::raised);
+  bounds::error_flag::raised = false;
+}
+
+/**
+ * Tests that exception throws std::out_of_range.
+ */
+TEST(bounds_tests, exception) {
+
+  using A = fast32<bounds::exception>;
+
+  EXPECT_THROW(A::to_date(min - 1), std::out_of_range);
+  EXPECT_THROW(A::to_date(max + 1), std::out_of_range);
+  EXPECT_THROW(A::to_rata_die(A::date_min.year - 1, 1, 1),
+    std::out_of_range);
+  EXPECT_THROW(A::to_rata_die(A::date_max.year + 1, 12, 31),
+    std::out_of_range);
+  EXPECT_NO_THROW(A::to_rata_die(A::date_max.year, A::date_max.month,
+    A::date_max.day));
+
+  EXPECT_THROW((gregorian::to_date<int32_t, bounds::exception>(INT32_MAX)),
+    std::out_of_range);
+  EXPECT_THROW((gregorian::to_rata_die<int32_t, bounds::exception>(INT32_MAX,
+    1, 1)), std::out_of_range);
+  EXPECT_THROW((gregorian::to_date_opt<int32_t, 719468, 82,
+    bounds::exception>(INT32_MAX)), std::out_of_range);
+
+  EXPECT_FALSE((noexcept(gregorian::to_date<int32_t, bounds::exception>(0))));
+  EXPECT_TRUE((noexcept(gregorian::to_date<int32_t, bounds::saturate>(0))));
+}
+
+/**
+ * Tests that the check of an algorithm whose range is the whole input type
+ * never fires.
+ */
+TEST(bounds_tests, full_range) {
+
+  using A = benjoffe_fast64_t<epoch::unix_time, bounds::exception>;
+  using J = julian_fast64_t<bounds::exception>;
+
+  EXPECT_NO_THROW(A::to_date(INT32_MIN));
+  EXPECT_NO_THROW(A::to_date(INT32_MAX));
+  EXPECT_NO_THROW(J::to_date(INT32_MIN));
+  EXPECT_NO_THROW(J::to_date(INT32_MAX));
+  EXPECT_THROW(J::to_rata_die(J::date_max.year + 1, 1, 1), std::out_of_range);
+
+  using O = ordinal_benjoffe_fast32_t<epoch::unix_time, bounds::exception>;
+  EXPECT_NO_THROW(O::to_date(O::rata_die_max));
+  EXPECT_THROW(O::to_date(O::rata_die_max + 1), std::out_of_range);
+}
+
+//--------------------------------------------------------------------------
+// Batch
+//--------------------------------------------------------------------------
+
+/**
+ * Tests the masks of the batch conversions against the scalar checks, for
+ * random inputs half of which are out of range and counts that are not
+ * multiples of 64.
+ */
+TEST(bounds_tests, batch) {
+
+  using A = benjoffe_fast32;
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<int32_t> inside(min, max);
+  std::uniform_int_distribution<int32_t> outside(max + 1, INT32_MAX);
+
+  for (size_t count : { size_t(0), size_t(1), size_t(64), size_t(1000) }) {
+
+    std::vector<int32_t> rata_dies(count);
+    for (size_t i = 0; i < count; ++i)
+      rata_dies[i] = rng() % 2 ? inside(rng) : outside(rng);
+
+    std::vector<date32_t> dates(count);
+    std::vector<uint64_t> mask((count + 63) / 64);
+    bounds::to_date<A>(rata_dies.data(), dates.data(), count, mask.data());
+
+    std::vector<int32_t> round_trip(count);
+    std::vector<uint64_t> mask_rt((count + 63) / 64);
+    bounds::to_rata_die<A>(dates.data(), round_trip.data(), count,
+      mask_rt.data());
+
+    for (size_t i = 0; i < count; ++i) {
+      int32_t const n = rata_dies[i];
+      bool const out = n < min || max < n;
+      bool const bit = (mask[i / 64] >> (i % 64)) & 1;
+      ASSERT_EQ(bit, out) << "Failed for rata_die = " << n;
+      if (!out) {
+        ASSERT_EQ(dates[i], A::to_date(n)) << "Failed for rata_die = " << n;
+        ASSERT_FALSE((mask_rt[i / 64] >> (i % 64)) & 1) << "Failed for "
+          "date = " << dates[i];
+        ASSERT_EQ(round_trip[i], n) << "Failed for date = " << dates[i];
+      }
+    }
+  }
+
+  // Dates next to the limits:
+  std::vector<date32_t> const dates = {
+    A::date_min, A::date_max, { A::date_max.year + 1, 1, 1 },
+    { A::date_min.year - 1, 12, 31 }, { 1970, 1, 1 },
+  };
+  uint64_t mask;
+  std::vector<int32_t> rata_dies(dates.size());
+  bounds::to_rata_die<A>(dates.data(), rata_dies.data(), dates.size(), &mask);
+  EXPECT_EQ(mask, 0b01100u);
+}
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file business_days_tests.cpp
+ *
+ * @brief Command line program that tests the business-day arithmetic
+ *   against loops over days.
+ */
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "util/business_days.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// 400 years from 1 January 1900, and a margin around them for the loops:
+int32_t const first  = benjoffe_fast64::to_rata_die(1900, 1, 1);
+int32_t const last   = first + 146097;
+int32_t const margin = 64;
+
+/**
+ * Holidays in the window and its margin: 1 January and 25 December of each
+ * year (also on weekends, which are ignored), a few random days, some
+ * twice, and runs of days.
+ */
+static std::vector<int32_t> holidays() {
+  std::vector<int32_t> days;
+  for (int32_t year = 1899; year <= 2300; ++year) {
+    days.push_back(benjoffe_fast64::to_rata_die(year, 1, 1));
+    days.push_back(benjoffe_fast64::to_rata_die(year, 12, 25));
+  }
+  std::uniform_int_distribution<int32_t> uniform_dist(first - margin,
+    last + margin);
+  std::mt19937 rng;
+  for (int i = 0; i < 4000; ++i)
+    days.push_back(uniform_dist(rng));
+  for (int32_t d = 0; d < 20; ++d)
+    days.push_back(first + 1000 + d);
+  for (int32_t d = 0; d < 20; ++d)
+    days.push_back(first + 1000 + d);
+  std::sort(days.begin(), days.end());
+  return days;
+}
+
+static bool naive_is_business_day(std::vector<int32_t> const& holidays,
+  int32_t rd) {
+  // 1 January 1970 is a Thursday:
+  int32_t const weekday = ((rd + 3) % 7 + 7) % 7; // Monday = 0
+  return weekday < 5 &&
+    std::find(holidays.begin(), holidays.end(), rd) == holidays.end();
+}
+
+// The window and its margin: flags[rd - first + margin] for rd.
+static std::vector<bool> flags(std::vector<int32_t> const& holidays) {
+  std::vector<bool> f;
+  for (int32_t rd = first - margin; rd < last + margin; ++rd)
+    f.push_back(naive_is_business_day(holidays, rd));
+  return f;
+}
+
+static void check(std::vector<int32_t> const& holidays) {
+
+  business_days const b(holidays);
+  std::vector<bool> const f = flags(holidays);
+  auto const is_business = [&](int32_t rd) { return f[rd - first + margin]; };
+
+  int32_t count = 0; // business days in [first, rd[
+  for (int32_t rd = first; rd < last; ++rd) {
+
+    ASSERT_EQ(b.is_business_day(rd), is_business(rd)) << "Failed for rd = "
+      << rd;
+    ASSERT_EQ(b.business_days_between(first, rd), count) <<
+      "Failed for rd = " << rd;
+    ASSERT_EQ(b.business_days_between(rd, first), -count) <<
+      "Failed for rd = " << rd;
+
+    // Loops forwards and backwards:
+    int32_t day = rd;
+    for (int32_t n = 1; n <= 12; ++n) {
+      do ++day; while (!is_business(day));
+      ASSERT_EQ(b.add_business_days(rd, n), day) << "Failed for rd = " <<
+        rd << " and n = " << n;
+    }
+    day = rd;
+    for (int32_t n = -1; n >= -12; --n) {
+      do --day; while (!is_business(day));
+      ASSERT_EQ(b.add_business_days(rd, n), day) << "Failed for rd = " <<
+        rd << " and n = " << n;
+    }
+    ASSERT_EQ(b.add_business_days(rd, 0), rd) << "Failed for rd = " << rd;
+
+    count += is_business(rd);
+  }
+}
+
+/**
+ * Tests business days without holidays against loops over 400 years.
+ */
+TEST(business_days_tests, weekends) {
+  check({});
+}
+
+/**
+ * Tests business days with holidays against loops over 400 years.
+ */
+TEST(business_days_tests, holidays) {
+  check(holidays());
+}
+
+/**
+ * Tests whether adding and counting business days agree on large n, and the
+ * batch forms.
+ */
+TEST(business_days_tests, round_trip) {
+
+  business_days const b(holidays());
+  std::uniform_int_distribution<int32_t> days(first, last - 1);
+  std::uniform_int_distribution<int32_t> steps(1, 50000);
+  std::mt19937 rng;
+
+  std::vector<int32_t> rds, ns, results(1000), counts(1000);
+  for (int i = 0; i < 1000; ++i) {
+    rds.push_back(days(rng));
+    ns.push_back(i % 2 ? steps(rng) : -steps(rng));
+  }
+  b.add_business_days(rds.data(), 10, results.data(), rds.size());
+
+  for (size_t i = 0; i < rds.size(); ++i) {
+    int32_t const rd = rds[i];
+    int32_t const n  = ns[i];
+    int32_t const d  = b.add_business_days(rd, n);
+    ASSERT_TRUE(b.is_business_day(d)) << "Failed for rd = " << rd <<
+      " and n = " << n;
+    // (rd, d] holds n business days for n > 0, [d, rd[ holds -n for n < 0:
+    ASSERT_EQ(n > 0 ? b.business_days_between(rd + 1, d + 1) :
+      b.business_days_between(rd, d), n) << "Failed for rd = " << rd <<
+      " and n = " << n;
+    ASSERT_EQ(results[i], b.add_business_days(rd, 10)) << "Failed for rd = "
+      << rd;
+  }
+
+  b.business_days_between(rds.data(), results.data(), counts.data(),
+    rds.size());
+  for (size_t i = 0; i < rds.size(); ++i)
+    ASSERT_EQ(counts[i], b.business_days_between(rds[i], results[i])) <<
+      "Failed for rd = " << rds[i];
+}
+
+/**
+ * Tests unsorted holidays.
+ */
+TEST(business_days_tests, invalid) {
+  EXPECT_THROW(business_days({ 10, 9 }), std::invalid_argument);
+}
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file code_size_tests.cpp
+ *
+ * @brief Command line program that tests the ELF symbol reader and the
+ *   instruction decoders of the code size report.
+ */
+
+#include "tests/tests.hpp"
+
+#include "util/code_size.hpp"
+#include "util/elf_symbols.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+/**
+ * Tests lengths and targets of x86-64 instructions as disassembled by
+ * objdump.
+ */
+TEST(code_size_tests, x86_64) {
+
+  struct {
+    std::vector<uint8_t>  bytes;
+    instruction_t::kind_t kind;
+    uint64_t              target; // For ip = 0x1000
+  } const instructions[] = {
+    // lea 0x10(%rip),%rax
+    { { 0x48, 0x8d, 0x05, 0x10, 0x00, 0x00, 0x00 }, instruction_t::data,
+      0x1017 },
+    // call 0x1000
+    { { 0xe8, 0xfb, 0xff, 0xff, 0xff }, instruction_t::branch, 0x1000 },
+    // je 0x1006
+    { { 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00 }, instruction_t::branch,
+      0x1006 },
+    // vzeroupper
+    { { 0xc5, 0xf8, 0x77 }, instruction_t::other, 0 },
+    // vmovdqa32 0x100(%rip),%zmm0
+    { { 0x62, 0xf1, 0x7d, 0x48, 0x6f, 0x05, 0x00, 0x01, 0x00, 0x00 },
+      instruction_t::data, 0x110a },
+    // vbroadcastss 0x4(%rip),%ymm0
+    { { 0xc4, 0xe2, 0x7d, 0x18, 0x05, 0x04, 0x00, 0x00, 0x00 },
+      instruction_t::data, 0x100d },
+    // movabs $0x807060504030201,%rax
+    { { 0x48, 0xb8, 1, 2, 3, 4, 5, 6, 7, 8 }, instruction_t::other, 0 },
+    // palignr $0x8,%xmm1,%xmm0
+    { { 0x66, 0x0f, 0x3a, 0x0f, 0xc1, 0x08 }, instruction_t::other, 0 },
+    // test $0x1,%edi
+    { { 0xf7, 0xc7, 0x01, 0x00, 0x00, 0x00 }, instruction_t::other, 0 },
+    // mov 0x401000(,%rax,4),%eax
+    { { 0x8b, 0x04, 0x85, 0x00, 0x10, 0x40, 0x00 }, instruction_t::data,
+      0x401000 },
+    // cs nopw 0x0(%rax,%rax,1)
+    { { 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      instruction_t::other, 0 },
+    // movl $0x12345678,(%r8)
+    { { 0x41, 0xc7, 0x00, 0x78, 0x56, 0x34, 0x12 }, instruction_t::other,
+      0 },
+  };
+
+  for (auto const& expected : instructions) {
+    instruction_t const instruction = code_size::decode_x86_64(
+      expected.bytes.data(), expected.bytes.size(), 0x1000);
+    EXPECT_EQ(instruction.length, expected.bytes.size()) << "Failed for "
+      "opcode " << int(expected.bytes[0]);
+    EXPECT_EQ(instruction.kind, expected.kind);
+    if (expected.kind != instruction_t::other) {
+      EXPECT_EQ(instruction.target, expected.target);
+    }
+  }
+
+  // Truncated:
+  uint8_t const call[] = { 0xe8, 0xfb, 0xff };
+  EXPECT_EQ(code_size::decode_x86_64(call, 3, 0x1000).length, 0u);
+}
+
+/**
+ * Tests targets of AArch64 instructions as disassembled by llvm-mc.
+ */
+TEST(code_size_tests, aarch64) {
+
+  std::vector<uint8_t> const code = {
+    0x02, 0x00, 0x00, 0x94, // bl #8
+    0xff, 0xff, 0xff, 0x17, // b #-4
+    0x00, 0x00, 0x00, 0xb0, // adrp x0, #4096
+    0x00, 0x40, 0x00, 0x91, // add x0, x0, #16
+    0x00, 0x00, 0x00, 0xb0, // adrp x0, #4096
+    0x01, 0x08, 0x40, 0xf9, // ldr x1, [x0, #16]
+  };
+
+  uint64_t const base = 0x10000;
+
+  instruction_t const bl = code_size::decode_aarch64(code, 0, base);
+  EXPECT_EQ(bl.kind, instruction_t::branch);
+  EXPECT_EQ(bl.target, base + 8);
+
+  instruction_t const b = code_size::decode_aarch64(code, 4, base);
+  EXPECT_EQ(b.kind, instruction_t::branch);
+  EXPECT_EQ(b.target, base);
+
+  instruction_t const add = code_size::decode_aarch64(code, 8, base);
+  EXPECT_EQ(add.kind, instruction_t::data);
+  EXPECT_EQ(add.target, base + 0x1010);
+
+  instruction_t const ldr = code_size::decode_aarch64(code, 16, base);
+  EXPECT_EQ(ldr.kind, instruction_t::data);
+  EXPECT_EQ(ldr.target, base + 0x1010);
+}
+
+int32_t const table[64] = { 1 };
+
+extern "C" int32_t eaf_code_size_tests_lookup(int32_t i) {
+  return table[i & 63];
+}
+
+/**
+ * Tests measuring a function of this program, which uses a table.
+ */
+TEST(code_size_tests, measure) {
+
+  elf_symbols const image = elf_symbols::load("/proc/self/exe");
+  if (image.empty())
+    GTEST_SKIP() << "Not an ELF file or stripped";
+
+  elf_symbol_t const* const lookup = image.find(
+    "eaf_code_size_tests_lookup");
+  ASSERT_NE(lookup, nullptr);
+  EXPECT_TRUE(lookup->function);
+  EXPECT_EQ(image.code(*lookup).size(), lookup->size);
+
+  code_size_t const size = code_size::measure(image, lookup->address);
+  EXPECT_EQ(size.functions, 1u);
+  EXPECT_EQ(size.bytes, lookup->size);
+  EXPECT_GT(size.instructions, 0u);
+  if (image.machine == elf_symbols::x86_64 ||
+    image.machine == elf_symbols::aarch64) {
+    EXPECT_TRUE(size.decoded);
+    EXPECT_EQ(size.table_bytes, sizeof(table));
+  }
+}
+
+} // namespace tests
+} // namespace eaf
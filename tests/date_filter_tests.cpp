@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file date_filter_tests.cpp
+ *
+ * @brief Command line program that tests calendar predicates compiled to
+ *   intervals of day numbers against decoding every day.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/date_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+static bool reference(date_predicate_t const& predicate, int32_t n) {
+  date32_t const date = benjoffe_fast64::to_date(n);
+  return predicate.year_min <= date.year && date.year <= predicate.year_max &&
+    (predicate.months >> date.month & 1) && (predicate.days >> date.day & 1);
+}
+
+static void test(date_predicate_t const& predicate, day_interval_t domain,
+  std::vector<int32_t> const& days) {
+
+  date_filter const filter = date_filter::compile(predicate, domain);
+
+  for (size_t i = 1; i < filter.intervals().size(); ++i)
+    ASSERT_LT(int64_t(filter.intervals()[i - 1].last) + 1,
+      filter.intervals()[i].first) << "Intervals are not sorted and disjoint";
+
+  std::vector<uint64_t> selection((days.size() + 63) / 64);
+  filter.select(days.data(), days.size(), selection.data());
+
+  for (size_t i = 0; i < days.size(); ++i) {
+    bool const selected = selection[i / 64] >> (i % 64) & 1;
+    ASSERT_EQ(selected, reference(predicate, days[i])) << "Failed for "
+      "rata_die = " << days[i] << " and " << filter.intervals().size() <<
+      " intervals";
+  }
+}
+
+/**
+ * Tests common predicates on every day of 1950 to 2050.
+ */
+TEST(date_filter_tests, common) {
+
+  day_interval_t const domain = { -7305, 29220 };
+  std::vector<int32_t> days;
+  for (int32_t n = domain.first; n <= domain.last; ++n)
+    days.push_back(n);
+
+  date_predicate_t february;
+  february.months = 1 << 2;
+  test(february, domain, days);
+
+  date_predicate_t first_of_month;
+  first_of_month.days = 1 << 1;
+  test(first_of_month, domain, days);
+
+  date_predicate_t between;
+  between.year_min = 2000;
+  between.year_max = 2010;
+  test(between, domain, days);
+
+  date_predicate_t leap_day;
+  leap_day.months = 1 << 2;
+  leap_day.days   = 1 << 29;
+  test(leap_day, domain, days);
+
+  date_predicate_t nothing;
+  nothing.year_min = 3000;
+  test(nothing, domain, days);
+
+  test(date_predicate_t{}, domain, days);
+}
+
+/**
+ * Tests random predicates on random days.
+ */
+TEST(date_filter_tests, random) {
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<int32_t> year_dist(1900, 2100);
+  std::uniform_int_distribution<int32_t> day_dist(-25567, 47846);
+
+  day_interval_t const domain = { -25567, 47846 }; // 1900 to 2100
+
+  for (int i = 0; i < 200; ++i) {
+
+    std::vector<int32_t> days(1000 + rng() % 64);
+    for (int32_t& n : days)
+      n = day_dist(rng);
+
+    date_predicate_t predicate;
+    predicate.year_min = year_dist(rng);
+    predicate.year_max = predicate.year_min + int32_t(rng() % 50);
+    predicate.months   = rng() & 0x1ffe;
+    predicate.days     = rng() & (i % 2 ? 0xfffffffe : 0x0000fffe);
+    test(predicate, domain, days);
+  }
+}
+
+/**
+ * Tests random predicates on random days of a domain too large for a bitmap
+ * (1000000 days either side of 1970, about 5480 years).
+ */
+TEST(date_filter_tests, search) {
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<int32_t> year_dist(-800, 4700);
+  std::uniform_int_distribution<int32_t> day_dist(-1000000, 1000000);
+
+  day_interval_t const domain = { -1000000, 1000000 };
+
+  for (int i = 0; i < 20; ++i) {
+
+    std::vector<int32_t> days(1000 + rng() % 64);
+    for (int32_t& n : days)
+      n = day_dist(rng);
+
+    date_predicate_t predicate;
+    predicate.year_min = year_dist(rng);
+    predicate.year_max = predicate.year_min + int32_t(rng() % 2000);
+    predicate.months   = rng() & 0x1ffe;
+    predicate.days     = rng() & (i % 2 ? 0xfffffffe : 0x0000fffe);
+    test(predicate, domain, days);
+  }
+}
+
+/**
+ * Tests the ends of the 32-bit range.
+ */
+TEST(date_filter_tests, limits) {
+
+  day_interval_t const domain = { INT32_MIN, INT32_MAX };
+  std::vector<int32_t> days;
+  for (int32_t n = 0; n < 1000; ++n) {
+    days.push_back(INT32_MIN + n);
+    days.push_back(INT32_MAX - n);
+  }
+
+  date_predicate_t january;
+  january.months = 1 << 1;
+  january.year_min = benjoffe_fast64::date_min.year;
+  january.year_max = benjoffe_fast64::date_min.year + 1;
+  test(january, domain, days);
+
+  date_predicate_t december;
+  december.months = 1 << 12;
+  december.year_min = benjoffe_fast64::date_max.year - 1;
+  test(december, domain, days);
+
+  test(date_predicate_t{}, domain, days);
+}
+
+} // namespace tests
+} // namespace eaf
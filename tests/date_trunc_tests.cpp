@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file date_trunc_tests.cpp
+ *
+ * @brief Command line program that tests the period truncation kernels
+ *   against decoding the date and encoding the first day of the period.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "eaf/gregorian.hpp"
+#include "util/date_trunc.hpp"
+#include "util/epoch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// Days tested at each end of the input range and around 1 January 1970.
+int64_t static constexpr window = 2 * 146097;
+
+// Reference: the first day of the period of the date of rata die n, counted
+// from the epoch, computed with 64-bit textbook algorithms.
+template <date_trunc::period P>
+static int64_t reference(int64_t n, int32_t epoch) {
+
+  int64_t const unix_time = n + epoch;
+
+  if constexpr (P == date_trunc::week) {
+    // 1 January 1970 is a Thursday, i.e., 3 days after a Monday:
+    int64_t const weekday = ((unix_time + 3) % 7 + 7) % 7;
+    return n - weekday;
+  }
+
+  date_t<int64_t> const date = gregorian::to_date<int64_t>(unix_time +
+    719468);
+  uint32_t month = 1;
+  if constexpr (P == date_trunc::month)
+    month = date.month;
+  else if constexpr (P == date_trunc::quarter)
+    month = date.month - (date.month - 1) % 3;
+  return gregorian::to_rata_die<int64_t>(date.year, month, 1) - 719468 -
+    epoch;
+}
+
+template <typename A, int32_t E>
+struct with_epoch {
+  using algorithm_t = A;
+  int32_t static constexpr epoch = E;
+};
+
+template <typename T>
+struct date_trunc_tests : public ::testing::Test {
+}; // struct date_trunc_tests
+
+using implementations = ::testing::Types<
+  with_epoch<benjoffe_fast64,     epoch::unix_time>,
+  with_epoch<benjoffe_fast64_mjd, epoch::mjd      >,
+  with_epoch<benjoffe_fast32,     epoch::unix_time>,
+  with_epoch<benjoffe_fast32_ole, epoch::ole      >
+>;
+
+// The extra comma below is to silent a warning.
+// https://github.com/google/googletest/issues/2271#issuecomment-665742471
+TYPED_TEST_SUITE(date_trunc_tests, implementations, );
+
+template <typename TypeParam, date_trunc::period P>
+static void test_period() {
+
+  using algorithm_t = typename TypeParam::algorithm_t;
+
+  int64_t const rata_die_min = algorithm_t::rata_die_min;
+  int64_t const rata_die_max = algorithm_t::rata_die_max;
+  int64_t const unix_time    = -window / 2 - TypeParam::epoch;
+
+  std::vector<int32_t> inputs;
+  for (int64_t n : { rata_die_min, unix_time, rata_die_max - window + 1 })
+    for (int64_t const end = n + window; n < end; ++n)
+      inputs.push_back(int32_t(n));
+
+  std::vector<int32_t> starts(inputs.size());
+  date_trunc::to_start<P, algorithm_t>(inputs.data(), starts.data(),
+    inputs.size());
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    int64_t const expected = reference<P>(inputs[i], TypeParam::epoch);
+    // The start of the first period might be out of range:
+    if (expected < INT32_MIN)
+      continue;
+    ASSERT_EQ(starts[i], expected) << "Failed for rata_die = " << inputs[i];
+  }
+}
+
+/**
+ * Tests to_week_start.
+ */
+TYPED_TEST(date_trunc_tests, week) {
+  test_period<TypeParam, date_trunc::week>();
+}
+
+/**
+ * Tests to_month_start.
+ */
+TYPED_TEST(date_trunc_tests, month) {
+  test_period<TypeParam, date_trunc::month>();
+}
+
+/**
+ * Tests to_quarter_start.
+ */
+TYPED_TEST(date_trunc_tests, quarter) {
+  test_period<TypeParam, date_trunc::quarter>();
+}
+
+/**
+ * Tests to_year_start.
+ */
+TYPED_TEST(date_trunc_tests, year) {
+  test_period<TypeParam, date_trunc::year>();
+}
+
+} // namespace tests
+} // namespace eaf
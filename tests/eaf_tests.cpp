@@ -14,6 +14,10 @@
  */
 
 #include "tests/tests.hpp"
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast32_wide.hpp"
+#include "algorithms/julian_fast32.hpp"
+#include "algorithms/julian_fast64.hpp"
 #include "eaf/date.hpp"
 #include "eaf/gregorian.hpp"
 #include "eaf/julian.hpp"
@@ -100,15 +104,100 @@ struct gregorian_unix :
 
 date32_t constexpr gregorian_unix::epoch;
 
+// Limits of algorithms supporting the full signed 32-bit rata die range on
+// the Julian calendar w.r.t. the Unix epoch.
+struct limits_julian_fast {
+  int32_t  static constexpr rata_die_min = INT32_MIN;
+  int32_t  static constexpr rata_die_max = INT32_MAX;
+  date32_t static constexpr date_min     = { -5877520,  3, 3 };
+  date32_t static constexpr date_max     = {  5881459, 10, 5 };
+};
+
+date32_t constexpr limits_julian_fast::date_min;
+date32_t constexpr limits_julian_fast::date_max;
+
+struct julian_fast32 : julian_helper_t, limits_julian_fast {
+
+  // 1 January 1970 of the Gregorian calendar.
+  static date32_t constexpr epoch = { 1969, 12, 19 };
+
+  static date32_t
+  to_date(int32_t N) noexcept {
+    return ::julian_fast32::to_date(N);
+  }
+
+  int32_t
+  static to_rata_die(int32_t Y_J, uint32_t M_J, uint32_t D_J) noexcept {
+    return ::julian_fast32::to_rata_die(Y_J, M_J, D_J);
+  }
+
+};
+
+date32_t constexpr julian_fast32::epoch;
+
+struct julian_fast64 : julian_helper_t, limits_julian_fast {
+
+  // 1 January 1970 of the Gregorian calendar.
+  static date32_t constexpr epoch = { 1969, 12, 19 };
+
+  static date32_t
+  to_date(int32_t N) noexcept {
+    return ::julian_fast64::to_date(N);
+  }
+
+  int32_t
+  static to_rata_die(int32_t Y_J, uint32_t M_J, uint32_t D_J) noexcept {
+    return ::julian_fast64::to_rata_die(Y_J, M_J, D_J);
+  }
+
+};
+
+date32_t constexpr julian_fast64::epoch;
+
+// The x86 and ARM variants (see eaf/variant.hpp) of Ben Joffe's 32-bit
+// algorithms, on their own ranges.
+template <typename A>
+struct benjoffe : gregorian_helper_t {
+
+  static date32_t constexpr epoch = { 1970, 1, 1 };
+
+  int32_t  static constexpr rata_die_min = A::rata_die_min;
+  int32_t  static constexpr rata_die_max = A::rata_die_max;
+  date32_t static constexpr date_min     = A::date_min;
+  date32_t static constexpr date_max     = A::date_max;
+
+  static date32_t
+  to_date(int32_t N) noexcept {
+    return A::to_date(N);
+  }
+
+  int32_t
+  static to_rata_die(int32_t Y, uint32_t M, uint32_t D) noexcept {
+    return A::to_rata_die(Y, M, D);
+  }
+
+};
+
+using benjoffe_fast32_x86      = benjoffe<::benjoffe_fast32_x86>;
+using benjoffe_fast32_arm      = benjoffe<::benjoffe_fast32_arm>;
+using benjoffe_fast32_wide_x86 = benjoffe<::benjoffe_fast32_wide_x86>;
+using benjoffe_fast32_wide_arm = benjoffe<::benjoffe_fast32_wide_arm>;
+
 template <typename A>
 struct eaf_tests : public ::testing::Test {
 }; // struct eaf_tests
 
 using calendars = ::testing::Types<
   julian,
+  julian_fast32,
+  julian_fast64,
   gregorian,
   gregorian_opt,
-  gregorian_unix
+  gregorian_unix,
+  benjoffe_fast32_x86,
+  benjoffe_fast32_arm,
+  benjoffe_fast32_wide_x86,
+  benjoffe_fast32_wide_arm
 >;
 
 // The extra comma below is to silent a warning.
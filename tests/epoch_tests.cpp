@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file epoch_tests.cpp
+ *
+ * @brief Command line program that tests the benjoffe algorithms
+ *   instantiated with epochs other than 1 January 1970.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast32_wide.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms_ordinal/ordinal_benjoffe_fast32.hpp"
+#include "algorithms_ordinal/ordinal_benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "eaf/gregorian.hpp"
+#include "util/epoch.hpp"
+#include "util/ordinal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace eaf {
+namespace tests {
+
+// Reference for rata dies (days since 1 January 1970) outside the 32-bit
+// range, using the textbook algorithm whose epoch is 1 March 0000.
+static date32_t reference_date(int64_t rata_die) {
+  date_t<int64_t> const date = gregorian::to_date<int64_t>(rata_die + 719468);
+  return { int32_t(date.year), date.month, date.day };
+}
+
+static ordinal32_t reference_ordinal(int64_t rata_die) {
+  date32_t const date = reference_date(rata_die);
+  int64_t const jan_1 = gregorian::to_rata_die<int64_t>(date.year, 1, 1);
+  int64_t const dec_31 = gregorian::to_rata_die<int64_t>(date.year, 12, 31);
+  uint32_t const ordinal = uint32_t(rata_die + 719468 - jan_1) + 1;
+  return { date.year, ordinal, dec_31 - jan_1 == 365 };
+}
+
+static bool operator ==(ordinal32_t const& x, ordinal32_t const& y) {
+  return x.year == y.year && x.ordinal == y.ordinal && x.leap == y.leap;
+}
+
+// Days tested at each end of the input range and around 1 January 1970.
+int32_t static constexpr window = 146097;
+
+template <template <int32_t> class A, int32_t E>
+struct with_epoch {
+  using algorithm_t = A<E>;
+  int32_t static constexpr epoch = E;
+};
+
+#define EAF_EPOCHS(A)                     \
+  with_epoch<A, ::epoch::unix_time>,      \
+  with_epoch<A, ::epoch::dotnet>,         \
+  with_epoch<A, ::epoch::ole>,            \
+  with_epoch<A, ::epoch::mjd>,            \
+  with_epoch<A, ::epoch::jdn>
+
+//--------------------------------------------------------------------------
+// Year, month, day
+//--------------------------------------------------------------------------
+
+template <typename T>
+struct epoch_tests : public ::testing::Test {
+}; // struct epoch_tests
+
+using implementations = ::testing::Types<
+  EAF_EPOCHS(benjoffe_fast64_t),
+  EAF_EPOCHS(benjoffe_fast32_t),
+  EAF_EPOCHS(benjoffe_fast32_wide_t)
+>;
+
+// The extra comma below is to silent a warning.
+// https://github.com/google/googletest/issues/2271#issuecomment-665742471
+TYPED_TEST_SUITE(epoch_tests, implementations, );
+
+/**
+ * Tests whether the epoch is mapped to 0.
+ */
+TYPED_TEST(epoch_tests, epoch) {
+
+  using algorithm_t = typename TypeParam::algorithm_t;
+  date32_t const date = reference_date(TypeParam::epoch);
+
+  EXPECT_EQ(algorithm_t::to_date(0), date);
+  EXPECT_EQ(to_rata_die<algorithm_t>(date), 0);
+}
+
+/**
+ * Tests the epoch shift against the Unix epoch algorithm around 1 January
+ * 1970.
+ */
+TYPED_TEST(epoch_tests, unix_time) {
+
+  using algorithm_t = typename TypeParam::algorithm_t;
+  using unix_t      = benjoffe_fast64;
+
+  for (int32_t u = -window; u < window; ++u) {
+    int32_t const n = u - TypeParam::epoch;
+    date32_t const date = unix_t::to_date(u);
+    ASSERT_EQ(algorithm_t::to_date(n), date) << "Failed for rata_die = " << n;
+    ASSERT_EQ(to_rata_die<algorithm_t>(date), n) << "Failed for date = " <<
+      date;
+  }
+}
+
+/**
+ * Tests to_date and to_rata_die at both ends of the input range.
+ */
+TYPED_TEST(epoch_tests, limits) {
+
+  using algorithm_t = typename TypeParam::algorithm_t;
+
+  int64_t const rata_die_min = algorithm_t::rata_die_min;
+  int64_t const rata_die_max = algorithm_t::rata_die_max;
+
+  for (int64_t n : { rata_die_min, rata_die_max - window + 1 }) {
+    for (int64_t const end = n + window; n < end; ++n) {
+      date32_t const date = reference_date(n + TypeParam::epoch);
+      ASSERT_EQ(algorithm_t::to_date(int32_t(n)), date) <<
+        "Failed for rata_die = " << n;
+      ASSERT_EQ(to_rata_die<algorithm_t>(date), n) << "Failed for date = " <<
+        date;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------
+// Year, ordinal
+//--------------------------------------------------------------------------
+
+template <typename T>
+struct ordinal_epoch_tests : public ::testing::Test {
+}; // struct ordinal_epoch_tests
+
+using ordinal_implementations = ::testing::Types<
+  EAF_EPOCHS(ordinal_benjoffe_fast64_t),
+  EAF_EPOCHS(ordinal_benjoffe_fast32_t)
+>;
+
+TYPED_TEST_SUITE(ordinal_epoch_tests, ordinal_implementations, );
+
+/**
+ * Tests to_date around 1 January 1970 and at both ends of the input range.
+ */
+TYPED_TEST(ordinal_epoch_tests, to_date) {
+
+  using algorithm_t = typename TypeParam::algorithm_t;
+
+  int64_t const rata_die_min = algorithm_t::rata_die_min;
+  int64_t const rata_die_max = algorithm_t::rata_die_max;
+  int64_t const unix_time    = -window / 2 - TypeParam::epoch;
+
+  for (int64_t n : { rata_die_min, unix_time, rata_die_max - window + 1 }) {
+    for (int64_t const end = n + window; n < end; ++n) {
+      ASSERT_TRUE(algorithm_t::to_date(int32_t(n)) ==
+        reference_ordinal(n + TypeParam::epoch)) << "Failed for rata_die = " <<
+        n;
+    }
+  }
+}
+
+#undef EAF_EPOCHS
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file fast16_tests.cpp
+ *
+ * @brief Command line program that tests benjoffe_fast16 on all 65,536
+ *   int16_t day numbers.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast16.hpp"
+#include "eaf/date.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+using A = benjoffe_fast16;
+
+/**
+ * Tests whether date_min and date_max are the dates of INT16_MIN and
+ * INT16_MAX and 1 January 1970 is 0.
+ */
+TEST(fast16_tests, limits) {
+  EXPECT_EQ(A::to_date(INT16_MIN), A::date_min);
+  EXPECT_EQ(A::to_date(INT16_MAX), A::date_max);
+  EXPECT_EQ(A::to_date(0), date32_t({ 1970, 1, 1 }));
+  EXPECT_EQ(A::to_rata_die(1970, 1, 1), 0);
+}
+
+/**
+ * Tests to_date and to_rata_die going forward over all inputs.
+ */
+TEST(fast16_tests, exhaustive) {
+
+  date32_t date = A::date_min;
+  for (int32_t n = INT16_MIN; n <= INT16_MAX; ++n) {
+    ASSERT_EQ(A::to_date(int16_t(n)), date) << "Failed for rata_die = " << n;
+    ASSERT_EQ(to_rata_die<A>(date), n) << "Failed for date = " << date;
+    gregorian_helper_t::advance(date);
+  }
+}
+
+/**
+ * Tests the batch forms against the scalar ones over all inputs. They go in
+ * two calls of 65,523 and 13 rows, neither a multiple of 16, so that the
+ * tails of the vector loops are tested too.
+ */
+TEST(fast16_tests, batch) {
+
+  size_t const count = 65536;
+  size_t const split = count - 13;
+  std::vector<int16_t> dayNumbers(count), years(count), back(count);
+  std::vector<uint8_t> months(count), days(count);
+
+  for (size_t i = 0; i < count; ++i)
+    dayNumbers[i] = int16_t(int32_t(i) + INT16_MIN);
+
+  for (size_t const i : { size_t(0), split }) {
+    size_t const n = i == 0 ? split : count - split;
+    A::to_date(dayNumbers.data() + i, years.data() + i, months.data() + i,
+      days.data() + i, n);
+    A::to_rata_die(years.data() + i, months.data() + i, days.data() + i,
+      back.data() + i, n);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    date32_t const date = A::to_date(dayNumbers[i]);
+    ASSERT_EQ(years[i], date.year) << "Failed for rata_die = " <<
+      dayNumbers[i];
+    ASSERT_EQ(months[i], date.month) << "Failed for rata_die = " <<
+      dayNumbers[i];
+    ASSERT_EQ(days[i], date.day) << "Failed for rata_die = " <<
+      dayNumbers[i];
+    ASSERT_EQ(back[i], dayNumbers[i]) << "Failed for date = " << date;
+  }
+}
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file fractional_day_tests.cpp
+ *
+ * @brief Command line program that tests the splitting of Julian Dates and
+ *   OLE Automation dates against an exact 128-bit integer reference.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/epoch.hpp"
+#include "util/fractional_day.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// The reference needs a signed 128-bit integer type.
+#if defined(__SIZEOF_INT128__)
+
+// Found by argument-dependent lookup from gtest:
+static bool operator ==(day_time_t const& x, day_time_t const& y) {
+  return x.day == y.day && x.nanosecond == y.nanosecond;
+}
+
+static std::ostream& operator <<(std::ostream& os, day_time_t const& x) {
+  return os << x.day << " + " << x.nanosecond << " ns";
+}
+
+namespace eaf {
+namespace tests {
+
+__extension__ typedef __int128 int128_t;
+
+int64_t static constexpr ns_per_day = fractional_day::NS_PER_DAY;
+
+/**
+ * Returns floor(x * 86400 * 10^9) computed exactly. Writing x = m * 2^e,
+ * with m an integer of at most 53 bits, the product m * 86400 * 10^9 fits
+ * in 101 bits and the shift by -e is a floor for signed integers.
+ */
+static int128_t reference_ns(double x) {
+  int e;
+  double const f = std::frexp(x, &e);
+  int64_t const m = int64_t(std::ldexp(f, 53));
+  e -= 53;
+  int128_t const product = int128_t(m) * ns_per_day;
+  if (e >= 0)
+    return product << e;
+  return product >> (e > -127 ? -e : 127);
+}
+
+static day_time_t reference_split(int128_t ns) {
+  int128_t day = ns / ns_per_day;
+  int128_t rem = ns % ns_per_day;
+  if (rem < 0) {
+    --day;
+    rem += ns_per_day;
+  }
+  return { int32_t(day), uint64_t(rem) };
+}
+
+/**
+ * Returns random Julian Dates and OLE dates of 800 years around 1 January
+ * 1970, doubles of random bit patterns with the day in the 32-bit range, and
+ * edge cases (zeros, subnormals, tiny magnitudes, neighbours of integers and
+ * halves.)
+ */
+static std::vector<double> inputs() {
+
+  std::vector<double> xs;
+  std::mt19937_64 rng;
+
+  std::uniform_real_distribution<double> jd(2440587.5 - 146097,
+    2440587.5 + 146097);
+  std::uniform_real_distribution<double> ole(-25569.0 - 146097,
+    -25569.0 + 146097);
+  for (int i = 0; i < 1000000; ++i) {
+    xs.push_back(jd(rng));
+    xs.push_back(ole(rng));
+  }
+
+  // Biased exponents from 0 (subnormals) to 1053, i.e., |x| < 2^31.
+  for (int i = 0; i < 1000000; ++i) {
+    uint64_t const bits = rng();
+    uint64_t const exp = (bits >> 52) % 1054;
+    double const x = std::bit_cast<double>((bits & ~(uint64_t(0x7ff) << 52)) |
+      (exp << 52));
+    if (std::fabs(x) < 2147483647.0)
+      xs.push_back(x);
+  }
+
+  double const inf = std::numeric_limits<double>::infinity();
+  for (double x : { 0.0, 0.5, 1.0, 2440587.5, 1e9, 2147483647.0 }) {
+    for (double y : { x, -x }) {
+      xs.push_back(y);
+      xs.push_back(std::nextafter(y, inf));
+      xs.push_back(std::nextafter(y, -inf));
+    }
+  }
+  for (double x : { 1e-300, 4.9e-324, 2.2e-308, 1e-5, 0x1p-11, 0x1p-12 }) {
+    xs.push_back(x);
+    xs.push_back(-x);
+  }
+
+  return xs;
+}
+
+static std::vector<double> const xs = inputs();
+
+/**
+ * Tests split against the reference.
+ */
+TEST(fractional_day_tests, split) {
+  for (double x : xs)
+    ASSERT_EQ(fractional_day::split(x), reference_split(reference_ns(x))) <<
+      "Failed for x = " << std::hexfloat << x;
+}
+
+/**
+ * Tests from_julian_date against the reference shifted by half a day.
+ */
+TEST(fractional_day_tests, from_julian_date) {
+  for (double x : xs) {
+    if (x >= 2147483647.0)
+      continue;
+    ASSERT_EQ(fractional_day::from_julian_date(x),
+      reference_split(reference_ns(x) + ns_per_day / 2)) <<
+      "Failed for x = " << std::hexfloat << x;
+  }
+}
+
+/**
+ * Tests from_ole against the reference on |x| and the day truncated towards
+ * zero.
+ */
+TEST(fractional_day_tests, from_ole) {
+  for (double x : xs) {
+    day_time_t expected = reference_split(reference_ns(std::fabs(x)));
+    if (x < 0)
+      expected.day = -expected.day;
+    ASSERT_EQ(fractional_day::from_ole(x), expected) <<
+      "Failed for x = " << std::hexfloat << x;
+  }
+
+  EXPECT_EQ(fractional_day::from_ole(-1.25),
+    (day_time_t{ -1, 6 * 3600 * 1000000000ull }));
+  EXPECT_EQ(fractional_day::from_ole(-0.5), fractional_day::from_ole(0.5));
+}
+
+/**
+ * Tests the batch forms against the scalar ones and a known accurate date
+ * algorithm.
+ */
+TEST(fractional_day_tests, batch) {
+
+  std::vector<double> const jds(xs.begin(), xs.begin() + 2000000);
+  size_t const count = jds.size();
+
+  std::vector<date32_t> dates(count);
+  std::vector<uint64_t> nanoseconds(count);
+
+  fractional_day::from_julian_date(jds.data(), dates.data(),
+    nanoseconds.data(), count);
+  for (size_t i = 0; i < count; ++i) {
+    day_time_t const dt = fractional_day::from_julian_date(jds[i]);
+    ASSERT_EQ(dates[i], benjoffe_fast64::to_date(dt.day - 2440588)) <<
+      "Failed for x = " << std::hexfloat << jds[i];
+    ASSERT_EQ(nanoseconds[i], dt.nanosecond) <<
+      "Failed for x = " << std::hexfloat << jds[i];
+  }
+
+  fractional_day::from_ole(jds.data(), dates.data(), nanoseconds.data(),
+    count);
+  for (size_t i = 0; i < count; ++i) {
+    day_time_t const dt = fractional_day::from_ole(jds[i]);
+    ASSERT_EQ(dates[i], benjoffe_fast64::to_date(dt.day - 25569)) <<
+      "Failed for x = " << std::hexfloat << jds[i];
+    ASSERT_EQ(nanoseconds[i], dt.nanosecond) <<
+      "Failed for x = " << std::hexfloat << jds[i];
+  }
+}
+
+} // namespace tests
+} // namespace eaf
+
+#endif // defined(__SIZEOF_INT128__)
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file histogram_tests.cpp
+ *
+ * @brief Command line program that tests to_month_index and the histograms
+ *   by month.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// Days tested at each end of the input range and around 1 January 1970.
+int64_t static constexpr window = 2 * 146097;
+
+template <typename A>
+static void test_month_index() {
+  int64_t const rata_die_min = A::rata_die_min;
+  int64_t const rata_die_max = A::rata_die_max;
+  for (int64_t n : { rata_die_min, -window / 2, rata_die_max - window + 1 }) {
+    for (int64_t const end = n + window; n < end; ++n) {
+      date32_t const date = A::to_date(int32_t(n));
+      ASSERT_EQ(A::to_month_index(int32_t(n)),
+        date.year * 12 + int32_t(date.month) - 1) << "Failed for rata_die = " <<
+        n;
+    }
+  }
+}
+
+/**
+ * Tests to_month_index against to_date.
+ */
+TEST(histogram_tests, month_index) {
+  test_month_index<benjoffe_fast32>();
+  test_month_index<benjoffe_fast32_jdn>();
+  test_month_index<benjoffe_fast64>();
+  test_month_index<benjoffe_fast64_ole>();
+}
+
+template <typename A>
+static void test_month_bins() {
+
+  // A through the scalar form of month_bins:
+  struct scalar {
+    static int32_t to_month_index(int32_t n) { return A::to_month_index(n); }
+  };
+
+  // Bins of the whole range, and of 1990 to 2030, with days outside it:
+  uint32_t const bases[]  = { uint32_t(A::to_month_index(A::rata_die_min)),
+    1990 * 12 };
+  uint32_t const months[] = { UINT32_MAX, 12 * 40 };
+
+  // Of an odd size, for the scalar tails:
+  size_t const size = 4095;
+  std::vector<int32_t>  days(size);
+  std::vector<uint32_t> bins(size), expected(size);
+
+  int64_t const rata_die_min = A::rata_die_min;
+  int64_t const rata_die_max = A::rata_die_max;
+  for (int64_t n : { rata_die_min, -window / 2, rata_die_max - window + 1 }) {
+    for (int64_t const end = n + window; n < end; n += size) {
+      size_t const count = size_t(std::min(int64_t(size), end - n));
+      for (size_t i = 0; i < count; ++i)
+        days[i] = int32_t(n + int64_t(i));
+      for (size_t k = 0; k < 2; ++k) {
+        month_bins<A>::fill(days.data(), bins.data(), count, bases[k],
+          months[k]);
+        month_bins<scalar>::fill(days.data(), expected.data(), count,
+          bases[k], months[k]);
+        ASSERT_EQ(bins, expected) << "Failed for rata_die = " << n;
+      }
+    }
+  }
+}
+
+/**
+ * Tests the vector form of month_bins against the scalar one.
+ */
+TEST(histogram_tests, month_bins) {
+  test_month_bins<benjoffe_fast32>();
+  test_month_bins<benjoffe_fast32_jdn>();
+  test_month_bins<benjoffe_fast32_x86>();
+}
+
+/**
+ * Tests histogram_by_month, serial and threaded, against counting decoded
+ * dates, for days some of which are outside the range and counts that are
+ * not multiples of the block size.
+ */
+TEST(histogram_tests, histogram_by_month) {
+
+  month_range_t const range = { 1990, 12 * 40 + 5 };
+
+  std::mt19937 rng;
+  // 1950 to 2050:
+  std::uniform_int_distribution<int32_t> uniform_dist(-7305, 29220);
+
+  for (size_t count : { size_t(0), size_t(3), size_t(4096), size_t(100003) }) {
+
+    std::vector<int32_t> days(count);
+    for (int32_t& n : days)
+      n = uniform_dist(rng);
+
+    std::vector<uint32_t> expected(range.months);
+    for (int32_t n : days) {
+      date32_t const date = benjoffe_fast64::to_date(n);
+      int32_t const bin = (date.year - range.year) * 12 + date.month - 1;
+      if (0 <= bin && bin < int32_t(range.months))
+        ++expected[bin];
+    }
+
+    for (unsigned threads : { 1u, 3u }) {
+      // Counts are added to:
+      std::vector<uint32_t> counts(range.months, 1);
+      histogram_by_month(days.data(), count, range, counts.data(), threads);
+      for (uint32_t m = 0; m < range.months; ++m)
+        ASSERT_EQ(counts[m], expected[m] + 1) << "Failed for month = " << m <<
+          " and count = " << count;
+    }
+
+    std::vector<uint32_t> counts(range.months);
+    histogram_by_month<benjoffe_fast64>(days.data(), count, range,
+      counts.data());
+    ASSERT_EQ(counts, expected);
+  }
+}
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file julian_gregorian_tests.cpp
+ *
+ * @brief Command line program that tests conversions of historical dates
+ *   with a Julian to Gregorian changeover.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/julian_gregorian.hpp"
+#include "eaf/date.hpp"
+#include "eaf/julian.hpp"
+#include "eaf/limits.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+template <typename T>
+int32_t to_rata_die(date32_t date, int32_t changeover) {
+  return T::to_rata_die(date.year, date.month, date.day, changeover);
+}
+
+// Reference chaining scalar calls to the textbook Julian algorithm, whose
+// epoch is 1 March 0000 of the Julian calendar, and benjoffe_fast64.
+struct reference {
+
+  static int32_t constexpr julian_epoch = 719470;
+
+  static date32_t to_date(int32_t n, int32_t changeover) {
+    if (n < changeover)
+      return ::eaf::julian::to_date(n + julian_epoch);
+    return benjoffe_fast64::to_date(n);
+  }
+
+  static int32_t to_rata_die(int32_t year, uint32_t month, uint32_t day,
+    int32_t changeover) {
+    int32_t const n = ::eaf::julian::to_rata_die(year, month, day) -
+      julian_epoch;
+    if (n < changeover)
+      return n;
+    return benjoffe_fast64::to_rata_die(year, month, day);
+  }
+};
+
+// Range of eaf::julian::to_rata_die shifted to the Unix epoch. (date_max
+// is read as Gregorian, which is fine since it is within range as Julian.)
+static int32_t const rata_die_min = to_rata_die<julian_gregorian>(
+  limits<int32_t>::date_min, julian_gregorian::rome);
+static int32_t const rata_die_max = to_rata_die<julian_gregorian>(
+  limits<int32_t>::date_max, julian_gregorian::rome);
+
+template <typename C>
+struct julian_gregorian_tests : public ::testing::Test {
+}; // struct julian_gregorian_tests
+
+// Changeovers, each tested on the x86 and ARM code paths.
+
+template <typename A>
+struct rome {
+  using algorithm_t = A;
+  static int32_t  constexpr changeover = julian_gregorian::rome;
+  static date32_t constexpr last_julian = { 1582, 10,  4 };
+  static date32_t constexpr first_gregorian = { 1582, 10, 15 };
+};
+
+template <typename A>
+struct britain {
+  using algorithm_t = A;
+  static int32_t  constexpr changeover = julian_gregorian::britain;
+  static date32_t constexpr last_julian = { 1752,  9,  2 };
+  static date32_t constexpr first_gregorian = { 1752,  9, 14 };
+};
+
+using changeovers = ::testing::Types<
+  rome   <julian_gregorian_x86>,
+  rome   <julian_gregorian_arm>,
+  britain<julian_gregorian_x86>,
+  britain<julian_gregorian_arm>
+>;
+
+// The extra comma below is to silent a warning.
+// https://github.com/google/googletest/issues/2271#issuecomment-665742471
+TYPED_TEST_SUITE(julian_gregorian_tests, changeovers, );
+
+/**
+ * Tests the days around the changeover.
+ */
+TYPED_TEST(julian_gregorian_tests, changeover) {
+
+  using changeover_t = TypeParam;
+  using A = typename changeover_t::algorithm_t;
+  int32_t const changeover = changeover_t::changeover;
+
+  EXPECT_EQ(A::to_date(changeover - 1, changeover), changeover_t::last_julian);
+  EXPECT_EQ(A::to_date(changeover, changeover), changeover_t::first_gregorian);
+  EXPECT_EQ(to_rata_die<A>(changeover_t::last_julian, changeover),
+    changeover - 1);
+  EXPECT_EQ(to_rata_die<A>(changeover_t::first_gregorian, changeover),
+    changeover);
+}
+
+/**
+ * Tests to_date and to_rata_die going forward and backward from the
+ * changeover over the whole range of eaf::julian::to_rata_die.
+ */
+TYPED_TEST(julian_gregorian_tests, round_trip) {
+
+  using changeover_t = TypeParam;
+  using A = typename changeover_t::algorithm_t;
+  int32_t const changeover = changeover_t::changeover;
+
+  date32_t date = changeover_t::first_gregorian;
+  for (int32_t n = changeover; n < rata_die_max; ) {
+    ASSERT_EQ(to_rata_die<A>(date, changeover), n) << "Failed for date = " <<
+      date;
+    date32_t const tomorrow = A::to_date(++n, changeover);
+    ASSERT_EQ(tomorrow, gregorian_helper_t::advance(date)) <<
+      "Failed for rata_die = " << n;
+  }
+
+  date = changeover_t::last_julian;
+  for (int32_t n = changeover - 1; rata_die_min < n; ) {
+    ASSERT_EQ(to_rata_die<A>(date, changeover), n) << "Failed for date = " <<
+      date;
+    date32_t const yesterday = A::to_date(--n, changeover);
+    ASSERT_EQ(yesterday, julian_helper_t::regress(date)) <<
+      "Failed for rata_die = " << n;
+  }
+}
+
+/**
+ * Tests the batch functions against the scalar ones and the reference on
+ * 800 years around the changeover.
+ */
+TYPED_TEST(julian_gregorian_tests, batch) {
+
+  using changeover_t = TypeParam;
+  using A = typename changeover_t::algorithm_t;
+  int32_t const changeover = changeover_t::changeover;
+
+  std::vector<int32_t> rata_dies;
+  for (int32_t n = changeover - 146097; n < changeover + 146097; ++n)
+    rata_dies.push_back(n);
+
+  size_t const count = rata_dies.size();
+  std::vector<date32_t> historical(count), gregorian(count), back(count);
+  std::vector<int32_t>  rata_dies_back(count);
+
+  A::to_date(rata_dies.data(), historical.data(), count, changeover);
+  A::to_rata_die(historical.data(), rata_dies_back.data(), count, changeover);
+  A::to_gregorian(historical.data(), gregorian.data(), count, changeover);
+  A::to_historical(gregorian.data(), back.data(), count, changeover);
+
+  for (size_t i = 0; i < count; ++i) {
+    int32_t const n = rata_dies[i];
+    ASSERT_EQ(historical[i], A::to_date(n, changeover)) <<
+      "Failed for rata_die = " << n;
+    ASSERT_EQ(historical[i], reference::to_date(n, changeover)) <<
+      "Failed for rata_die = " << n;
+    ASSERT_EQ(to_rata_die<reference>(historical[i], changeover), n) <<
+      "Failed for rata_die = " << n;
+    ASSERT_EQ(rata_dies_back[i], n) << "Failed for rata_die = " << n;
+    ASSERT_EQ(gregorian[i], benjoffe_fast64::to_date(n)) <<
+      "Failed for rata_die = " << n;
+    ASSERT_EQ(back[i], historical[i]) << "Failed for rata_die = " << n;
+  }
+}
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file month_runs_tests.cpp
+ *
+ * @brief Command line program that tests month_runs against decoding every
+ *   day of sorted columns.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/month_runs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+template <typename A>
+static void test(std::vector<int32_t> const& days) {
+
+  std::vector<month_run_t> const runs = month_runs<A>(days.data(),
+    days.size());
+
+  size_t i = 0;
+  for (month_run_t const& run : runs) {
+    ASSERT_EQ(run.begin, i) << "Runs are not consecutive";
+    ASSERT_LT(run.begin, run.end) << "Run is empty";
+    for (; i < run.end; ++i) {
+      date32_t const date = A::to_date(days[i]);
+      ASSERT_EQ(run.month, date.year * 12 + int32_t(date.month) - 1) <<
+        "Failed for rata_die = " << days[i];
+    }
+    if (run.end < days.size()) {
+      date32_t const prev = A::to_date(days[run.end - 1]);
+      date32_t const next = A::to_date(days[run.end]);
+      ASSERT_TRUE(prev.year != next.year || prev.month != next.month) <<
+        "Run ends early at rata_die = " << days[run.end];
+    }
+  }
+  ASSERT_EQ(i, days.size());
+}
+
+template <typename A>
+static void test_random() {
+
+  std::mt19937 rng;
+
+  // Dense (many days per month), sparse (runs of one day) and mixed:
+  for (int32_t span : { 400, 36524, 1000000 }) {
+    std::uniform_int_distribution<int32_t> uniform_dist(-span, span);
+    for (size_t count : { size_t(0), size_t(1), size_t(1000),
+      size_t(100003) }) {
+      std::vector<int32_t> days(count);
+      for (int32_t& n : days)
+        n = uniform_dist(rng);
+      std::sort(days.begin(), days.end());
+      test<A>(days);
+    }
+  }
+}
+
+/**
+ * Tests sorted random days.
+ */
+TEST(month_runs_tests, random) {
+  test_random<benjoffe_fast32>();
+  test_random<benjoffe_fast64>();
+  test_random<benjoffe_fast64_jdn>();
+}
+
+template <typename A>
+static void test_limits() {
+
+  std::vector<int32_t> days;
+  for (int32_t n = 0; n < 100; ++n)
+    days.push_back(A::rata_die_min + n);
+  test<A>(days);
+
+  days.clear();
+  for (int32_t n = 99; n >= 0; --n)
+    days.push_back(A::rata_die_max - n);
+  days.push_back(A::rata_die_max);
+  test<A>(days);
+}
+
+/**
+ * Tests every day around 1 January 1970, with repeats, and the ends of the
+ * input range, where the next month might not be representable.
+ */
+TEST(month_runs_tests, limits) {
+
+  std::vector<int32_t> days;
+  for (int32_t n = -1000; n <= 1000; ++n)
+    for (int32_t r = 0; r <= (n & 3); ++r)
+      days.push_back(n);
+  test<benjoffe_fast64>(days);
+
+  test_limits<benjoffe_fast32>();
+  test_limits<benjoffe_fast64>();
+}
+
+} // namespace tests
+} // namespace eaf
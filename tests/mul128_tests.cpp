@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file mul128_tests.cpp
+ *
+ * @brief Command line program that tests the 128-bit multiply policies and
+ * the algorithms instantiated with them.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms_ordinal/ordinal_benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "eaf/mul128.hpp"
+#include "util/ordinal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace eaf {
+namespace tests {
+
+template <typename M>
+struct mul128_tests : public ::testing::Test {
+}; // struct mul128_tests
+
+using policies = ::testing::Types<
+#if defined(__BMI2__)
+  mul128::mulx,
+#endif
+  mul128::portable
+>;
+
+// The extra comma below is to silent a warning.
+// https://github.com/google/googletest/issues/2271#issuecomment-665742471
+TYPED_TEST_SUITE(mul128_tests, policies, );
+
+/**
+ * Tests mul and mulh against the native policy.
+ */
+TYPED_TEST(mul128_tests, products) {
+
+  using M = TypeParam;
+
+  auto const check = [](uint64_t const a, uint64_t const b) {
+    uint64_t hi, expected_hi;
+    uint64_t const lo = M::mul(a, b, &hi);
+    uint64_t const expected_lo = mul128::native::mul(a, b, &expected_hi);
+    ASSERT_EQ(lo, expected_lo) << "Failed for " << a << " * " << b;
+    ASSERT_EQ(hi, expected_hi) << "Failed for " << a << " * " << b;
+    ASSERT_EQ(M::mulh(a, b), expected_hi) << "Failed for " << a << " * " << b;
+  };
+
+  uint64_t const edges[] = { 0, 1, UINT32_MAX, uint64_t(UINT32_MAX) + 1,
+    UINT64_MAX / 2, UINT64_MAX - 1, UINT64_MAX };
+  for (uint64_t const a : edges)
+    for (uint64_t const b : edges)
+      check(a, b);
+
+  std::mt19937_64 rng;
+  for (uint32_t i = 0; i < 1000000; ++i)
+    check(rng(), rng() >> (i % 64));
+}
+
+/**
+ * Tests benjoffe_fast64 and ordinal_benjoffe_fast64 against their native
+ * instantiations over 800 years centered in 1 January 1970 and samples of
+ * the whole input range.
+ */
+TYPED_TEST(mul128_tests, algorithms) {
+
+  using M = TypeParam;
+  using A = benjoffe_fast64_t<epoch::unix_time, bounds::unchecked,
+    variant::native, M>;
+  using O = ordinal_benjoffe_fast64_t<epoch::unix_time, bounds::unchecked,
+    M>;
+
+  auto const check = [](int32_t const n) {
+    ASSERT_EQ(A::to_date(n), benjoffe_fast64::to_date(n)) <<
+      "Failed for rata_die = " << n;
+    ordinal32_t const ord = O::to_date(n);
+    ordinal32_t const expected = ordinal_benjoffe_fast64::to_date(n);
+    ASSERT_EQ(ord.year, expected.year) << "Failed for rata_die = " << n;
+    ASSERT_EQ(ord.ordinal, expected.ordinal) << "Failed for rata_die = " << n;
+    ASSERT_EQ(ord.leap, expected.leap) << "Failed for rata_die = " << n;
+  };
+
+  for (int32_t n = -146097; n <= 146097; ++n)
+    check(n);
+
+  for (int64_t n = INT32_MIN; n <= INT32_MAX; n += 4093)
+    check(int32_t(n));
+  check(INT32_MAX);
+}
+
+} // namespace tests
+} // namespace eaf
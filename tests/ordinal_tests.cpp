@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-ordinal-date
+
+/**
+ * @file ordinal_tests.cpp
+ *
+ * @brief Command line program that tests the (year, ordinal) kernels of
+ *   benjoffe_ordinal_alternative.
+ */
+
+#include "tests/tests.hpp"
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "algorithms/benjoffe_ordinal_alternative.hpp"
+#include "algorithms_ordinal/ordinal_test.hpp"
+#include "eaf/date.hpp"
+#include "util/ordinal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+using alternative = benjoffe_ordinal_alternative;
+
+// Same 800 years centered in 1 January 1970 as algorithm_tests.
+int32_t static constexpr rata_die_min = -146097;
+int32_t static constexpr rata_die_max =  146097;
+
+/**
+ * Tests ordinal_to_month_day against a known accurate YMD algorithm.
+ */
+TEST(ordinal_tests, ordinal_to_month_day) {
+
+  for (int32_t n = rata_die_min; n < rata_die_max; ++n) {
+    ordinal32_t const ord = ordinal_test::to_date(n);
+    date32_t const date = benjoffe_fast64::to_date(n);
+    month_day_t const md = alternative::ordinal_to_month_day(ord.ordinal,
+      ord.leap);
+    ASSERT_EQ(md.month, date.month) << "Failed for rata_die = " << n;
+    ASSERT_EQ(md.day, date.day) << "Failed for rata_die = " << n;
+  }
+}
+
+/**
+ * Tests the batch ordinal_to_month_day against the scalar one.
+ */
+TEST(ordinal_tests, ordinal_to_month_day_batch) {
+
+  size_t const count = 365 + 366;
+  std::unique_ptr<uint32_t[]> ordinals(new uint32_t[count]);
+  std::unique_ptr<bool[]>     leaps(new bool[count]);
+
+  size_t i = 0;
+  for (uint32_t leap = 0; leap <= 1; ++leap) {
+    for (uint32_t ordinal = 1; ordinal <= 365 + leap; ++ordinal, ++i) {
+      ordinals[i] = ordinal;
+      leaps[i] = leap;
+    }
+  }
+
+  std::vector<uint32_t> months(count), days(count);
+  alternative::ordinal_to_month_day(ordinals.get(), leaps.get(),
+    months.data(), days.data(), count);
+
+  for (i = 0; i < count; ++i) {
+    month_day_t const md = alternative::ordinal_to_month_day(ordinals[i],
+      leaps[i]);
+    ASSERT_EQ(months[i], md.month) << "Failed for ordinal = " << ordinals[i];
+    ASSERT_EQ(days[i], md.day) << "Failed for ordinal = " << ordinals[i];
+  }
+}
+
+/**
+ * Tests month_day_to_ordinal for every day of a common and a leap year.
+ */
+TEST(ordinal_tests, month_day_to_ordinal) {
+
+  for (int32_t year : { 1970, 1972 }) {
+    bool const leap = year == 1972;
+    uint32_t ordinal = 0;
+    for (date32_t date = { year, 1, 1 }; date.year == year;
+      gregorian_helper_t::advance(date)) {
+      ASSERT_EQ(alternative::month_day_to_ordinal(date.month, date.day, leap),
+        ++ordinal) << "Failed for date = " << date;
+    }
+  }
+}
+
+/**
+ * Tests ordinal_to_rata_die going forward and backward from the epoch.
+ */
+TEST(ordinal_tests, ordinal_to_rata_die) {
+
+  for (int32_t n = rata_die_min; n < rata_die_max; ++n) {
+    ordinal32_t const ord = ordinal_test::to_date(n);
+    ASSERT_EQ(alternative::ordinal_to_rata_die(ord.year, ord.ordinal), n) <<
+      "Failed for rata_die = " << n;
+  }
+}
+
+/**
+ * Tests ordinal_to_rata_die near the limits of benjoffe_fast64::to_rata_die.
+ */
+TEST(ordinal_tests, ordinal_to_rata_die_limits) {
+
+  for (int32_t year : { -5877000, -5876999, 5881000, 5881001 }) {
+    uint32_t ordinal = 0;
+    for (date32_t date = { year, 1, 1 }; date.year == year;
+      gregorian_helper_t::advance(date)) {
+      ASSERT_EQ(alternative::ordinal_to_rata_die(year, ++ordinal),
+        to_rata_die<benjoffe_fast64>(date)) << "Failed for date = " << date;
+    }
+  }
+}
+
+} // namespace tests
+} // namespace eaf
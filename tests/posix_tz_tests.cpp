@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file posix_tz_tests.cpp
+ *
+ * @brief Command line program that tests the POSIX TZ rule engine on known
+ *   transitions and, with glibc, against localtime_r.
+ */
+
+#include "util/posix_tz.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// Northern and southern hemispheres, half-hour DST, negative DST, negative
+// and late rule times, Julian days, DST all year but at the start of the
+// year (taking offset_slow) and no DST.
+char const* const rules[] = {
+  "CET-1CEST,M3.5.0,M10.5.0/3",
+  "EST5EDT,M3.2.0,M11.1.0",
+  "AEST-10AEDT,M10.1.0,M4.1.0/3",
+  "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+  "IST-1GMT0,M10.5.0,M3.5.0/1",
+  "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1",
+  "<-02>2<-01>,M3.5.0/-1,M10.5.0/25",
+  "NST3:30NDT,M3.2.0/0:01,M11.1.0/0:01:30",
+  "XXX3YYY,J60,J300/1",
+  "XXX3YYY,59,299/1",
+  "WART4WARST,J1/0,J365/25",
+  "<+0545>-5:45",
+};
+
+/**
+ * Tests the 2025 transitions of Central European Time.
+ */
+TEST(posix_tz_tests, cet) {
+
+  posix_tz const tz("CET-1CEST,M3.5.0,M10.5.0/3");
+
+  EXPECT_EQ(tz.std_name(), "CET");
+  EXPECT_EQ(tz.dst_name(), "CEST");
+  EXPECT_EQ(tz.std_offset(), 3600);
+  EXPECT_EQ(tz.dst_offset(), 7200);
+
+  // 30 March 2025 01:00 UTC and 26 October 2025 01:00 UTC:
+  posix_tz::transitions_t const t = tz.transitions(2025);
+  EXPECT_EQ(t.dst_start, 1743296400);
+  EXPECT_EQ(t.dst_end,   1761440400);
+
+  EXPECT_EQ(tz.offset(t.dst_start - 1), 3600);
+  EXPECT_EQ(tz.offset(t.dst_start), 7200);
+  EXPECT_EQ(tz.offset(t.dst_end - 1), 7200);
+  EXPECT_EQ(tz.offset(t.dst_end), 3600);
+  EXPECT_TRUE(tz.is_dst(t.dst_start));
+  EXPECT_FALSE(tz.is_dst(t.dst_end));
+  EXPECT_EQ(tz.to_local(t.dst_start), t.dst_start + 7200);
+}
+
+/**
+ * Tests malformed strings.
+ */
+TEST(posix_tz_tests, invalid) {
+  char const* const invalid[] = {
+    "", ":Europe/Berlin", "CE-1", "CET", "CET-25", "CET-1:60", "<CE>-1",
+    "<CET-1", "CET-1CEST,M3.5.0", "CET-1CEST,M13.5.0,M10.5.0",
+    "CET-1CEST,M3.6.0,M10.5.0", "CET-1CEST,M3.5.7,M10.5.0",
+    "CET-1CEST,J0,J365", "CET-1CEST,366,0", "CET-1CEST,M3.5.0/168,M10.5.0",
+    "CET-1CEST,M3.5.0,M10.5.0x",
+  };
+  for (char const* tz : invalid)
+    EXPECT_THROW(posix_tz{tz}, std::invalid_argument) << "Failed for " << tz;
+}
+
+/**
+ * Tests whether offsets outside the cached years, found by offset_slow,
+ * agree with those in the cache.
+ */
+TEST(posix_tz_tests, out_of_range) {
+
+  for (char const* rule : rules) {
+    posix_tz const all(rule);
+    posix_tz const few(rule, 2000, 2010);
+    for (int32_t year = 1900; year <= 2100; ++year) {
+      posix_tz::transitions_t const t = all.transitions(year);
+      for (int64_t utc : { t.dst_start - 1, t.dst_start, t.dst_end - 1,
+        t.dst_end }) {
+        ASSERT_EQ(few.offset(utc), all.offset(utc)) << "Failed for " <<
+          rule << " and utc = " << utc;
+      }
+    }
+  }
+}
+
+#if defined(__GLIBC__)
+
+/**
+ * Tests the batch to_local against glibc's localtime_r on random times from
+ * 1970 to 2100 and around all transitions. Before 1970, glibc uses the
+ * transitions of 1970 rather than the rules.
+ */
+TEST(posix_tz_tests, localtime_r) {
+
+  char const* const old = std::getenv("TZ");
+  std::string const saved = old ? old : "";
+
+  for (char const* rule : rules) {
+
+    posix_tz const tz(rule);
+    setenv("TZ", rule, 1);
+    tzset();
+
+    std::vector<int64_t> utc;
+    std::uniform_int_distribution<int64_t> uniform_dist(0, 4133980799);
+    std::mt19937 rng;
+    for (int i = 0; i < 100000; ++i)
+      utc.push_back(uniform_dist(rng));
+    for (int32_t year = 1970; year <= 2100; ++year) {
+      posix_tz::transitions_t const t = tz.transitions(year);
+      for (int64_t d = -1; d <= 0; ++d) {
+        utc.push_back(t.dst_start + d);
+        utc.push_back(t.dst_end + d);
+      }
+    }
+
+    std::vector<int64_t> local(utc.size());
+    tz.to_local(utc.data(), local.data(), utc.size());
+
+    for (size_t i = 0; i < utc.size(); ++i) {
+      std::time_t const t = std::time_t(utc[i]);
+      std::tm tm;
+      localtime_r(&t, &tm);
+      ASSERT_EQ(local[i] - utc[i], tm.tm_gmtoff) << "Failed for " << rule <<
+        " and utc = " << utc[i];
+      ASSERT_EQ(tz.is_dst(utc[i]), tm.tm_isdst > 0) << "Failed for " <<
+        rule << " and utc = " << utc[i];
+    }
+  }
+
+  if (old)
+    setenv("TZ", saved.c_str(), 1);
+  else
+    unsetenv("TZ");
+  tzset();
+}
+
+#endif // defined(__GLIBC__)
+
+} // namespace tests
+} // namespace eaf
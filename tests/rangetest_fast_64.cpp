@@ -2,6 +2,7 @@
 // Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
 
 #include "eaf/date.hpp"
+#include "eaf/variant.hpp"
 #include "algorithms/_portable_uint128.hpp"
 #include <random>
 #include <stdint.h>
@@ -11,13 +12,7 @@
 #include <stdint.h>
 #include <iostream>
 #include <limits>
-
-
-#if defined(__aarch64__) || defined(_M_ARM64)
-#define TEST_IS_ARM 1
-#else
-#define TEST_IS_ARM 0
-#endif
+#include <string>
 
 /**
  * This is the same as the one in the algorithms folder except updated to: 
@@ -25,20 +20,16 @@
  * 2. Use the larger constant for ERAS to use a wider range.
  * 3. 64-bit intermediaries where required.
  */
+template <typename VARIANT>
 inline date64_t benjoffe_fast64_wide(int64_t dayNumber)
 {
   static uint64_t constexpr ERAS    = 4726498270ull;
   static uint64_t constexpr D_SHIFT = 146097ull * ERAS - 719469ull;
   static uint64_t constexpr Y_SHIFT = 400ull * ERAS - 1ull;
 
-#if TEST_IS_ARM
-  static uint32_t constexpr SCALE = 1;
-#else
-  static uint32_t constexpr SCALE = 32;
-  static uint32_t constexpr SHIFT_1 = 5980 * SCALE;
-#endif
-
+  static uint32_t constexpr SCALE = VARIANT::scale;
   static uint32_t constexpr SHIFT_0 = 30556 * SCALE;
+  static uint32_t constexpr SHIFT_1 = 5980 * SCALE;
 
   static uint64_t constexpr C1 = 505054698555331ull;
   static uint64_t constexpr C2 = 50504432782230121ull;
@@ -53,23 +44,16 @@ inline date64_t benjoffe_fast64_wide(int64_t dayNumber)
   uint64_t const low = uint64_t(num);
   uint32_t const ypt = uint32_t((uint128_t(24451 * SCALE) * low) >> 64);
 
-#if TEST_IS_ARM
-  uint32_t const phase = SHIFT_0;
-#else
-  uint32_t const bump = ypt < (3952 * SCALE);
-  uint32_t const phase = bump ? SHIFT_1 : SHIFT_0;
-#endif
+  uint32_t const early = ypt < (3952 * SCALE);
+  uint32_t const phase = !VARIANT::late_bump && early ? SHIFT_1 : SHIFT_0;
 
   uint32_t const N = (yrs % 4) * (16 * SCALE) + phase - ypt;
   uint32_t const M = N / (2048 * SCALE);
   uint32_t const D = uint32_t((uint128_t(C3) * (N % (2048 * SCALE))) >> 64);
 
-#if TEST_IS_ARM
-  uint32_t const bump = M > 12;
-  uint32_t const month = bump ? M - 12 : M;
-#else
-  uint32_t const month = M;
-#endif
+  uint32_t const late = M > 12;
+  uint32_t const bump = VARIANT::late_bump ? late : early;
+  uint32_t const month = VARIANT::late_bump && late ? M - 12 : M;
 
   uint32_t const day = D + 1;
   int64_t const year = int64_t(yrs) + int64_t(bump);
@@ -130,7 +114,8 @@ std::string pad2(int x) {
     return ss.str();
 }
 
-int main()
+template <typename VARIANT>
+int run()
 {
   int64_t EXPECT_FAIL_UP =  690527217032722ll;
   int64_t EXPECT_FAIL_DOWN = -690527216974165ll;
@@ -149,7 +134,7 @@ int main()
       
       int64_t z = UP_START + i;
 
-      date64_t j = benjoffe_fast64_wide(z);
+      date64_t j = benjoffe_fast64_wide<VARIANT>(z);
       date64_t h = neri_schneider_to_date(z);
 
       if (i % output_freq == 0) {
@@ -180,7 +165,7 @@ int main()
         
       int64_t z = DOWN_START - i;
 
-      date64_t j = benjoffe_fast64_wide(z);
+      date64_t j = benjoffe_fast64_wide<VARIANT>(z);
       date64_t h = neri_schneider_to_date(z);
 
       if (i % output_freq == 0) {
@@ -209,7 +194,7 @@ int main()
   {
     for (int64_t z = -(1ll << 32); z <= (1ll << 32); ++z) {
 
-      date64_t j = benjoffe_fast64_wide(z);
+      date64_t j = benjoffe_fast64_wide<VARIANT>(z);
       date64_t h = neri_schneider_to_date(z);
 
       if (z % output_freq == 0) {
@@ -237,7 +222,7 @@ int main()
 
   for (uint64_t i = 0; i < (1ll << 32); ++i) {
     int64_t z = dist(rng);
-    date64_t j = benjoffe_fast64_wide(z);
+    date64_t j = benjoffe_fast64_wide<VARIANT>(z);
     date64_t h = neri_schneider_to_date(z);
 
     if (!same_ymd(j, h)) {
@@ -260,7 +245,7 @@ int main()
   std::cout << "STARTING FULL DATE SEARCH (this will take a very long time):\n";
 
   for (int64_t z = DOWN_START; z < UP_START; ++z) {
-    date64_t j = benjoffe_fast64_wide(z);
+    date64_t j = benjoffe_fast64_wide<VARIANT>(z);
     date64_t h = neri_schneider_to_date(z);
 
     if (!same_ymd(j, h)) {
@@ -285,4 +270,20 @@ int main()
   std::cout << "\033[32mPass: All dates within range match.\033[0m\n";
 
   return 0;
+}
+
+// Usage: rangetest_fast_64 [x86|arm] (defaults to the host's variant).
+int main(int argc, char* argv[])
+{
+  std::string const variant = argc > 1 ? argv[1] : "native";
+
+  if (variant == "x86")
+    return run<eaf::variant::x86>();
+  if (variant == "arm")
+    return run<eaf::variant::arm>();
+  if (variant == "native")
+    return run<eaf::variant::native>();
+
+  std::cerr << "Unknown variant '" << variant << "' (use x86 or arm).\n";
+  return 1;
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file strftime_format_tests.cpp
+ *
+ * @brief Command line program that tests the strftime formatter on known
+ *   strings and, with glibc, against strftime on gmtime_r.
+ */
+
+#include "util/strftime_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// Every supported conversion, alone and in the benchmarked patterns.
+char const* const formats[] = {
+  "%a", "%A", "%b", "%B", "%c", "%C", "%d", "%D", "%e", "%F", "%g", "%G",
+  "%h", "%H", "%I", "%j", "%k", "%l", "%m", "%M", "%n", "%p", "%P", "%r",
+  "%R", "%s", "%S", "%t", "%T", "%u", "%U", "%V", "%w", "%W", "%x", "%X",
+  "%y", "%Y", "%%",
+  "%Y-%m-%d", "%d/%m/%Y %H:%M", "%a, %d %b %Y", "%Y-%m-%dT%H:%M:%S",
+  "week %V of %G (%g), day %j, %A %B %e", "no conversions",
+};
+
+static std::string format(strftime_format const& f, int64_t t) {
+  std::string s(f.max_size(), '\0');
+  s.resize(f.format(t, s.data()));
+  return s;
+}
+
+/**
+ * Tests known strings.
+ */
+TEST(strftime_format_tests, known) {
+
+  // Thursday 1 January 1970 00:00:00 and Friday 28 February 2025 13:05:09:
+  EXPECT_EQ(format(strftime_format("%c"), 0), "Thu Jan  1 00:00:00 1970");
+  EXPECT_EQ(format(strftime_format("%a, %d %b %Y %r"), 1740747909),
+    "Fri, 28 Feb 2025 01:05:09 PM");
+  EXPECT_EQ(format(strftime_format("%j %U %W %V %G %u %w"), 1740747909),
+    "059 08 08 09 2025 5 5");
+
+  // Years are not padded and %C, %y and %g are floored:
+  EXPECT_EQ(format(strftime_format("%Y %C %y"), -62198755200), "-1 -1 99");
+  EXPECT_EQ(format(strftime_format("%Y %C %y"), -62104060800), "2 0 02");
+  // Saturday 1 January of year 0 is in week 52 of ISO year -1:
+  EXPECT_EQ(format(strftime_format("%G %g %V"), -62167219200), "-1 99 52");
+}
+
+/**
+ * Tests unsupported formats.
+ */
+TEST(strftime_format_tests, invalid) {
+  char const* const invalid[] = {
+    "%", "%Y%", "%z", "%Z", "%Q", "%Ey", "%Oy", "%5Y", "%-d", "%_d", "%+",
+  };
+  for (char const* format : invalid)
+    EXPECT_THROW(strftime_format{format}, std::invalid_argument) <<
+      "Failed for " << format;
+}
+
+/**
+ * Tests whether the batch form writes the scalar form's rows back to back.
+ */
+TEST(strftime_format_tests, batch) {
+
+  strftime_format const f("%A %e %B %Y");
+  std::vector<int64_t> seconds;
+  std::uniform_int_distribution<int64_t> uniform_dist(-62167219200,
+    253402300799);
+  std::mt19937 rng;
+  for (int i = 0; i < 1000; ++i)
+    seconds.push_back(uniform_dist(rng));
+
+  std::string out(seconds.size() * f.max_size(), '\0');
+  std::vector<size_t> ends(seconds.size());
+  f.format(seconds.data(), seconds.size(), out.data(), ends.data());
+
+  size_t begin = 0;
+  for (size_t i = 0; i < seconds.size(); ++i) {
+    ASSERT_EQ(out.substr(begin, ends[i] - begin), format(f, seconds[i])) <<
+      "Failed for seconds = " << seconds[i];
+    begin = ends[i];
+  }
+}
+
+#if defined(__GLIBC__)
+
+/**
+ * Tests against glibc's strftime on gmtime_r for every day of 400 years
+ * (each at a different time of day) and random times from year -10000 to
+ * 12000. TZ is set to UTC for %s, which glibc finds by mktime.
+ */
+TEST(strftime_format_tests, strftime) {
+
+  char const* const old = std::getenv("TZ");
+  std::string const saved = old ? old : "";
+  setenv("TZ", "UTC0", 1);
+  tzset();
+
+  std::vector<int64_t> seconds;
+  std::mt19937 rng;
+  std::uniform_int_distribution<int64_t> time_of_day(0, 86399);
+  for (int64_t day = 0; day < 146097; ++day)
+    seconds.push_back(86400 * (day - 10957) + time_of_day(rng));
+  std::uniform_int_distribution<int64_t> uniform_dist(-377705116800,
+    316516406399);
+  for (int i = 0; i < 100000; ++i)
+    seconds.push_back(uniform_dist(rng));
+
+  for (char const* format : formats) {
+    strftime_format const f(format);
+    std::string out(f.max_size(), '\0');
+    for (int64_t t : seconds) {
+      std::time_t const time = std::time_t(t);
+      std::tm tm;
+      gmtime_r(&time, &tm);
+      char expected[256];
+      size_t const size = std::strftime(expected, sizeof(expected), format,
+        &tm);
+      ASSERT_EQ(std::string(out.data(), f.format(t, out.data())),
+        std::string(expected, size)) << "Failed for " << format <<
+        " and seconds = " << t;
+    }
+  }
+
+  if (old)
+    setenv("TZ", saved.c_str(), 1);
+  else
+    unsetenv("TZ");
+  tzset();
+}
+
+#endif // defined(__GLIBC__)
+
+} // namespace tests
+} // namespace eaf
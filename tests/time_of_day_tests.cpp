@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file time_of_day_tests.cpp
+ *
+ * @brief Command line program that tests the time of day kernels against
+ *   plain division, exhaustively over [0, 86400) seconds and [0, 86400000)
+ *   milliseconds.
+ */
+
+#include "util/time_of_day.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+uint32_t static constexpr seconds_per_day      = 86400;
+uint32_t static constexpr milliseconds_per_day = 86400000;
+
+/**
+ * Tests from_seconds against division.
+ */
+TEST(time_of_day_tests, from_seconds) {
+
+  for (uint32_t n = 0; n < seconds_per_day; ++n) {
+    hms_t const hms = time_of_day::from_seconds(n);
+    ASSERT_EQ(hms.hour, n / 3600) << "Failed for n = " << n;
+    ASSERT_EQ(hms.minute, n / 60 % 60) << "Failed for n = " << n;
+    ASSERT_EQ(hms.second, n % 60) << "Failed for n = " << n;
+    ASSERT_EQ(hms.millisecond, 0u) << "Failed for n = " << n;
+  }
+}
+
+/**
+ * Tests from_milliseconds against division.
+ */
+TEST(time_of_day_tests, from_milliseconds) {
+
+  for (uint32_t n = 0; n < milliseconds_per_day; ++n) {
+    hms_t const hms = time_of_day::from_milliseconds(n);
+    ASSERT_EQ(hms.hour, n / 3600000) << "Failed for n = " << n;
+    ASSERT_EQ(hms.minute, n / 60000 % 60) << "Failed for n = " << n;
+    ASSERT_EQ(hms.second, n / 1000 % 60) << "Failed for n = " << n;
+    ASSERT_EQ(hms.millisecond, n % 1000) << "Failed for n = " << n;
+  }
+}
+
+/**
+ * Tests the batch forms against the scalar ones, in chunks, over the same
+ * ranges. Chunks of odd sizes exercise the scalar tails of the vector paths.
+ */
+TEST(time_of_day_tests, batch) {
+
+  size_t const chunk = (1 << 20) - 1;
+  std::vector<uint32_t> ns(chunk);
+  std::vector<uint8_t>  hours(chunk), minutes(chunk), secs(chunk);
+  std::vector<uint16_t> millis(chunk);
+
+  for (uint32_t first = 0; first < milliseconds_per_day; first += chunk) {
+
+    size_t const count = milliseconds_per_day - first < chunk ?
+      milliseconds_per_day - first : chunk;
+    for (size_t i = 0; i < count; ++i)
+      ns[i] = first + uint32_t(i);
+
+    time_of_day::from_milliseconds(ns.data(), hours.data(), minutes.data(),
+      secs.data(), millis.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+      hms_t const hms = time_of_day::from_milliseconds(ns[i]);
+      ASSERT_EQ(hours[i], hms.hour) << "Failed for n = " << ns[i];
+      ASSERT_EQ(minutes[i], hms.minute) << "Failed for n = " << ns[i];
+      ASSERT_EQ(secs[i], hms.second) << "Failed for n = " << ns[i];
+      ASSERT_EQ(millis[i], hms.millisecond) << "Failed for n = " << ns[i];
+    }
+
+    if (first >= seconds_per_day)
+      continue;
+
+    size_t const n_secs = seconds_per_day - first < count ?
+      seconds_per_day - first : count;
+    time_of_day::from_seconds(ns.data(), hours.data(), minutes.data(),
+      secs.data(), n_secs);
+    for (size_t i = 0; i < n_secs; ++i) {
+      hms_t const hms = time_of_day::from_seconds(ns[i]);
+      ASSERT_EQ(hours[i], hms.hour) << "Failed for n = " << ns[i];
+      ASSERT_EQ(minutes[i], hms.minute) << "Failed for n = " << ns[i];
+      ASSERT_EQ(secs[i], hms.second) << "Failed for n = " << ns[i];
+    }
+  }
+}
+
+} // namespace tests
+} // namespace eaf
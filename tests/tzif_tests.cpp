@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+/**
+ * @file tzif_tests.cpp
+ *
+ * @brief Command line program that tests the TZif reader on the files of
+ *   tests/data/tzif and, with glibc, against localtime_r.
+ */
+
+#include "util/tzif.hpp"
+
+#include "eaf/date.hpp"
+#include "util/posix_tz.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace eaf {
+namespace tests {
+
+// Copies of tzdata 2025b (public domain). Lord Howe has a 30-minute DST,
+// Sao Paulo and Apia stopped DST and Apia skipped 30 December 2011.
+char const* const zones[] = {
+  "America_New_York",
+  "America_Sao_Paulo",
+  "Asia_Kolkata",
+  "Australia_Lord_Howe",
+  "Europe_Berlin",
+  "Pacific_Apia",
+};
+
+static std::string path(char const* zone) {
+  return std::string(EAF_TZIF_DIR) + "/" + zone;
+}
+
+// Random times from 1800 to 2200 and around all transitions.
+static std::vector<int64_t> times(tzif const& tz) {
+  std::uniform_int_distribution<int64_t> uniform_dist(-5364662400,
+    7258118399);
+  std::mt19937 rng;
+  std::vector<int64_t> ts;
+  for (int i = 0; i < 100000; ++i)
+    ts.push_back(uniform_dist(rng));
+  for (int64_t const t : tz.transitions()) {
+    ts.push_back(t - 1);
+    ts.push_back(t);
+  }
+  return ts;
+}
+
+// Version 2 TZif data with the given transitions, types (offsets, none
+// DST) and footer, after a minimal version 1 block.
+static std::vector<unsigned char> make_tzif(
+  std::vector<int64_t> const& transitions, std::vector<uint8_t> const& after,
+  std::vector<int32_t> const& offsets, std::string const& footer) {
+
+  std::vector<unsigned char> data;
+  auto const u32 = [&](uint32_t x) {
+    for (int shift = 24; shift >= 0; shift -= 8)
+      data.push_back((unsigned char) (x >> shift));
+  };
+  auto const header = [&](uint32_t timecnt, uint32_t typecnt) {
+    for (char const c : { 'T', 'Z', 'i', 'f', '2' })
+      data.push_back((unsigned char) c);
+    data.insert(data.end(), 15, 0);
+    for (uint32_t const count : { 0u, 0u, 0u, timecnt, typecnt, 1u })
+      u32(count);
+  };
+
+  header(0, 1);
+  u32(0);
+  data.insert(data.end(), 3, 0);
+
+  header(uint32_t(transitions.size()), uint32_t(offsets.size()));
+  for (int64_t const t : transitions) {
+    u32(uint32_t(uint64_t(t) >> 32));
+    u32(uint32_t(t));
+  }
+  data.insert(data.end(), after.begin(), after.end());
+  for (int32_t const offset : offsets) {
+    u32(uint32_t(offset));
+    data.insert(data.end(), 2, 0);
+  }
+  data.push_back(0);
+
+  data.push_back('\n');
+  data.insert(data.end(), footer.begin(), footer.end());
+  data.push_back('\n');
+  return data;
+}
+
+// Checks to_local_time, in scalar and batch forms, against rule from
+// 1800 to 2200, or from start on.
+static void check_rule(tzif const& tz, posix_tz const& rule,
+  int64_t start = -5364662400) {
+
+  std::uniform_int_distribution<int64_t> uniform_dist(start, 7258118399);
+  std::mt19937 rng;
+  std::vector<int64_t> ts(100000);
+  for (int64_t& t : ts)
+    t = uniform_dist(rng);
+  std::vector<local_time_t> local(ts.size());
+
+  for (bool sorted : { false, true }) {
+    if (sorted) {
+      std::sort(ts.begin(), ts.end());
+      tz.to_local_time_sorted(ts.data(), local.data(), ts.size());
+    }
+    else
+      tz.to_local_time(ts.data(), local.data(), ts.size());
+    for (size_t i = 0; i < ts.size(); ++i) {
+      int64_t const t = ts[i];
+      ASSERT_EQ(tz.offset(t), rule.offset(t)) << "Failed for utc = " << t;
+      ASSERT_EQ(tz.to_local_time(t).is_dst, rule.is_dst(t)) <<
+        "Failed for utc = " << t;
+      ASSERT_EQ(local[i].offset, rule.offset(t)) << "Failed for utc = " << t;
+      ASSERT_EQ(local[i].is_dst, rule.is_dst(t)) << "Failed for utc = " << t;
+    }
+  }
+}
+
+/**
+ * Tests that without transitions the footer applies to all times, as RFC
+ * 9636 says.
+ */
+TEST(tzif_tests, footer_only) {
+
+  char const* const footer = "CET-1CEST,M3.5.0,M10.5.0/3";
+  std::vector<unsigned char> const data = make_tzif({}, {}, { 3600 },
+    footer);
+  tzif const tz(data.data(), data.size());
+  EXPECT_TRUE(tz.transitions().empty());
+
+  // 1 July 2025 00:00 UTC:
+  EXPECT_EQ(tz.offset(1751328000), 7200);
+  EXPECT_TRUE(tz.to_local_time(1751328000).is_dst);
+  check_rule(tz, posix_tz(footer));
+}
+
+/**
+ * Tests that the footer applies past a change to a 257th type, which the
+ * transitions cannot index.
+ */
+TEST(tzif_tests, footer_past_256_types) {
+
+  // 256 types of offsets 0 to 255 seconds, none the footer's, and one
+  // transition on 1 January 2000:
+  std::vector<int32_t> offsets;
+  for (int32_t offset = 0; offset < 256; ++offset)
+    offsets.push_back(offset);
+  int64_t const start = 946684800;
+  char const* const footer = "EST5EDT,M3.2.0,M11.1.0";
+  std::vector<unsigned char> const data = make_tzif({ start }, { 255 },
+    offsets, footer);
+  tzif const tz(data.data(), data.size());
+
+  EXPECT_EQ(tz.transitions().size(), 1u);
+  EXPECT_EQ(tz.offset(start - 1), 0);
+  check_rule(tz, posix_tz(footer), start);
+}
+
+/**
+ * Tests the 2025 transitions of Europe/Berlin.
+ */
+TEST(tzif_tests, berlin) {
+
+  tzif const tz(path("Europe_Berlin"));
+  EXPECT_EQ(tz.footer(), "CET-1CEST,M3.5.0,M10.5.0/3");
+
+  // 30 March 2025 01:00 UTC:
+  local_time_t const before = tz.to_local_time(1743296399);
+  EXPECT_EQ(before.date, date32_t({ 2025, 3, 30 }));
+  EXPECT_EQ(before.hour, 1u);
+  EXPECT_EQ(before.minute, 59u);
+  EXPECT_EQ(before.second, 59u);
+  EXPECT_EQ(before.offset, 3600);
+  EXPECT_FALSE(before.is_dst);
+
+  local_time_t const after = tz.to_local_time(1743296400);
+  EXPECT_EQ(after.date, date32_t({ 2025, 3, 30 }));
+  EXPECT_EQ(after.hour, 3u);
+  EXPECT_EQ(after.minute, 0u);
+  EXPECT_EQ(after.second, 0u);
+  EXPECT_EQ(after.offset, 7200);
+  EXPECT_TRUE(after.is_dst);
+}
+
+/**
+ * Tests malformed data.
+ */
+TEST(tzif_tests, invalid) {
+
+  std::ifstream file(path("Europe_Berlin"), std::ios::binary);
+  std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)),
+    std::istreambuf_iterator<char>());
+  ASSERT_NO_THROW(tzif(data.data(), data.size()));
+
+  // Truncated anywhere, including the footer:
+  for (size_t size = 0; size < data.size(); ++size)
+    EXPECT_THROW(tzif(data.data(), size), std::invalid_argument) <<
+      "Failed for size = " << size;
+
+  data[0] = 'X';
+  EXPECT_THROW(tzif(data.data(), data.size()), std::invalid_argument);
+  EXPECT_THROW(tzif(path("Europe_Nowhere")), std::runtime_error);
+}
+
+/**
+ * Tests the batch forms against the scalar one, on unsorted and sorted rows.
+ */
+TEST(tzif_tests, batch) {
+
+  for (char const* zone : zones) {
+
+    tzif const tz(path(zone));
+    std::vector<int64_t> ts = times(tz);
+    std::vector<local_time_t> local(ts.size());
+
+    for (bool sorted : { false, true }) {
+      if (sorted) {
+        std::sort(ts.begin(), ts.end());
+        tz.to_local_time_sorted(ts.data(), local.data(), ts.size());
+      }
+      else
+        tz.to_local_time(ts.data(), local.data(), ts.size());
+      for (size_t i = 0; i < ts.size(); ++i) {
+        local_time_t const expected = tz.to_local_time(ts[i]);
+        ASSERT_EQ(local[i].date, expected.date) << "Failed for " << zone <<
+          " and utc = " << ts[i];
+        ASSERT_EQ(local[i].hour, expected.hour);
+        ASSERT_EQ(local[i].minute, expected.minute);
+        ASSERT_EQ(local[i].second, expected.second);
+        ASSERT_EQ(local[i].offset, expected.offset);
+        ASSERT_EQ(local[i].is_dst, expected.is_dst);
+      }
+    }
+  }
+}
+
+#if defined(__GLIBC__)
+
+/**
+ * Tests to_local_time against glibc's localtime_r with TZ set to the file.
+ */
+TEST(tzif_tests, localtime_r) {
+
+  char const* const old = std::getenv("TZ");
+  std::string const saved = old ? old : "";
+
+  for (char const* zone : zones) {
+
+    tzif const tz(path(zone));
+    std::string const tz_path = ":" + path(zone);
+    setenv("TZ", tz_path.c_str(), 1);
+    tzset();
+
+    for (int64_t const t : times(tz)) {
+      std::time_t const time = std::time_t(t);
+      std::tm tm;
+      localtime_r(&time, &tm);
+      local_time_t const local = tz.to_local_time(t);
+      ASSERT_EQ(local.offset, tm.tm_gmtoff) << "Failed for " << zone <<
+        " and utc = " << t;
+      ASSERT_EQ(local.is_dst, tm.tm_isdst > 0) << "Failed for " << zone <<
+        " and utc = " << t;
+      ASSERT_EQ(local.date, date32_t({ tm.tm_year + 1900,
+        uint32_t(tm.tm_mon + 1), uint32_t(tm.tm_mday) })) << "Failed for " <<
+        zone << " and utc = " << t;
+      ASSERT_EQ(local.hour, uint32_t(tm.tm_hour));
+      ASSERT_EQ(local.minute, uint32_t(tm.tm_min));
+      ASSERT_EQ(local.second, uint32_t(tm.tm_sec));
+    }
+  }
+
+  if (old)
+    setenv("TZ", saved.c_str(), 1);
+  else
+    unsetenv("TZ");
+  tzset();
+}
+
+#endif // defined(__GLIBC__)
+
+} // namespace tests
+} // namespace eaf
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_BUSINESS_DAYS_HPP
+#define EAF_UTIL_BUSINESS_DAYS_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Business-day arithmetic on day numbers (1 January 1970 = 0) in closed
+ * form: Monday to Friday are business days, except for optional holidays.
+ *
+ * Weekdays are numbered from a Monday far in the past, so that the k-th day
+ * from it has
+ *
+ *     B(k) = 5 * (k / 7) + min(k % 7, 5)
+ *
+ * weekdays before it, and the j-th weekday is the day 7 * (j / 5) + j % 5.
+ * The operands are shifted to be non-negative and compilers turn / 7 and
+ * / 5 into mul-shifts. Holidays are kept sorted, and those before a day are
+ * counted by branchless binary search. Holidays on weekends are ignored.
+ *
+ * Results out of the range of int32_t are unspecified.
+ */
+struct business_days {
+
+  /**
+   * Holidays, as day numbers in non-decreasing order, are not business days.
+   * Throws std::invalid_argument if they are not sorted.
+   */
+  explicit
+  business_days(std::vector<int32_t> const& holidays = {}) {
+    if (!std::is_sorted(holidays.begin(), holidays.end()))
+      throw std::invalid_argument("Holidays are not sorted.");
+    for (int32_t const h : holidays) {
+      if (is_weekend(h) || (!holidays_.empty() && holidays_.back() == h))
+        continue;
+      // Weekday index of the holiday, less the holidays before it:
+      keys_.push_back(weekdays_before(h) - int64_t(holidays_.size()));
+      holidays_.push_back(h);
+    }
+  }
+
+  std::vector<int32_t> const& holidays() const { return holidays_; }
+
+  bool is_business_day(int32_t rd) const {
+    size_t const r = rank<false>(holidays_, rd);
+    return !is_weekend(rd) && (r == holidays_.size() || holidays_[r] != rd);
+  }
+
+  /**
+   * Business days in [rd1, rd2[, or minus those in [rd2, rd1[ if rd2 < rd1.
+   */
+  int32_t business_days_between(int32_t rd1, int32_t rd2) const {
+    return int32_t(before(rd2) - before(rd1));
+  }
+
+  /**
+   * For n > 0, the n-th business day after rd; for n < 0, the -n-th business
+   * day before rd; for n == 0, rd (business day or not), as Excel's
+   * WORKDAY.
+   */
+  int32_t add_business_days(int32_t rd, int32_t n) const {
+    if (n == 0)
+      return rd;
+    // Index, among business days, of the result:
+    int64_t const m = n > 0 ? before(rd + int64_t(1)) + n - 1 :
+      before(rd) + n;
+    // Add the holidays up to the result, as in the search for the m-th
+    // integer missing from a sorted list: keys_ is non-decreasing.
+    return nth_weekday(m + int64_t(rank<true>(keys_, m)));
+  }
+
+  // Batch forms of the above, with the same n for all rows.
+
+  void business_days_between(int32_t const* rd1, int32_t const* rd2,
+    int32_t* counts, size_t count) const {
+    for (size_t i = 0; i < count; ++i)
+      counts[i] = business_days_between(rd1[i], rd2[i]);
+  }
+
+  void add_business_days(int32_t const* rds, int32_t n, int32_t* results,
+    size_t count) const {
+    for (size_t i = 0; i < count; ++i)
+      results[i] = add_business_days(rds[i], n);
+  }
+
+private:
+
+  // Day numbers shifted by this are non-negative and multiples of 7 on
+  // Mondays (1 January 1970 is a Thursday): their remainders by 7 are
+  // benjoffe_fast64::weekday.
+  static int64_t constexpr shift = 7 * (int64_t(1) << 31) + 3;
+
+  std::vector<int32_t> holidays_; // weekdays, sorted and unique
+  std::vector<int64_t> keys_;     // see the constructor
+
+  static inline
+  bool is_weekend(int32_t rd) {
+    return benjoffe_fast64::weekday(rd) >= 5;
+  }
+
+  // B above: weekdays from the shifted origin to rd, excluded. rd can be
+  // one past INT32_MAX, hence shift rather than benjoffe_fast64::weekday.
+  static inline
+  int64_t weekdays_before(int64_t rd) {
+    uint64_t const k = uint64_t(rd + shift);
+    uint64_t const r = k % 7;
+    return int64_t(5 * (k / 7) + (r < 5 ? r : 5));
+  }
+
+  // The j-th weekday from the shifted origin.
+  static inline
+  int32_t nth_weekday(int64_t j) {
+    uint64_t const u = uint64_t(j);
+    return int32_t(int64_t(7 * (u / 5) + u % 5) - shift);
+  }
+
+  // Elements of v less than (or equal to) x, by a binary search whose steps
+  // are arithmetic rather than branches, which holidays would mispredict.
+  template <bool or_equal, typename T>
+  static inline
+  size_t rank(std::vector<T> const& v, int64_t x) {
+    if (v.empty())
+      return 0;
+    T const* base = v.data();
+    size_t n = v.size();
+    while (n > 1) {
+      size_t const half = n / 2;
+      base += half * (or_equal ? base[half - 1] <= x : base[half - 1] < x);
+      n -= half;
+    }
+    return size_t(base - v.data()) + (or_equal ? *base <= x : *base < x);
+  }
+
+  // Business days from the shifted origin to rd, excluded.
+  int64_t before(int64_t rd) const {
+    return weekdays_before(rd) - int64_t(rank<false>(holidays_, rd));
+  }
+
+}; // struct business_days
+
+#endif // EAF_UTIL_BUSINESS_DAYS_HPP
@@ -0,0 +1,489 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_CODE_SIZE_HPP
+#define EAF_UTIL_CODE_SIZE_HPP
+
+#include "util/elf_symbols.hpp"
+
+#include <set>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Keeps a function out of line, e.g., to measure it.
+#if defined(_MSC_VER)
+#define EAF_NOINLINE __declspec(noinline)
+#else
+#define EAF_NOINLINE __attribute__((noinline))
+#endif
+
+// Static footprint of a function and of the functions it calls.
+struct code_size_t {
+  uint64_t bytes        = 0; // Machine code
+  uint64_t instructions = 0;
+  uint64_t table_bytes  = 0; // Data symbols referenced, e.g., lookup tables
+  uint32_t functions    = 0;
+  bool     decoded      = true; // Otherwise, instructions is a lower bound
+
+  // Conditional branches in the loops of the function, other than the back
+  // edges of the outermost loops, and all those of the functions it calls.
+  // A loop is the code between a backward branch and its target.
+  uint32_t loop_branches = 0;
+
+  std::vector<elf_symbol_t const*> symbols; // Functions and tables reached
+};
+
+// Symbols of this program are matched to functions by address, offset by
+// where the program is loaded, which this function gives.
+extern "C" inline uint64_t eaf_code_size_anchor() {
+  return 0;
+}
+
+// An instruction as far as code_size is concerned.
+struct instruction_t {
+
+  enum kind_t {
+    other,
+    branch,   // call or jump to target
+    data,     // memory operand or address at target
+  };
+
+  uint32_t length      = 0; // 0 if not decoded
+  kind_t   kind        = other;
+  bool     conditional = false; // For branches
+  uint64_t target      = 0;
+};
+
+struct code_size {
+
+  /**
+   * Returns the footprint of the function at address (e.g., of a symbol of
+   * image) and, recursively, of the functions of image it calls or jumps
+   * to. Indirect calls (e.g., through the PLT to shared libraries) are not
+   * followed. Only x86-64 and AArch64 are decoded.
+   */
+  static code_size_t measure(elf_symbols const& image, uint64_t address) {
+
+    code_size_t size;
+    std::set<uint64_t> functions, tables;
+    std::vector<uint64_t> pending = { address };
+
+    while (!pending.empty()) {
+
+      elf_symbol_t const* const f = image.find(pending.back());
+      pending.pop_back();
+      if (!f || !f->function || !functions.insert(f->address).second)
+        continue;
+
+      std::vector<uint8_t> const code = image.code(*f);
+      size.bytes += f->size;
+      ++size.functions;
+      size.symbols.push_back(f);
+
+      // Addresses of the conditional branches and of the loops:
+      std::vector<uint64_t> conditionals;
+      std::vector<std::pair<uint64_t, uint64_t>> loops;
+
+      for (size_t i = 0; i < code.size(); ) {
+
+        instruction_t const instruction = image.machine ==
+          elf_symbols::aarch64 ? decode_aarch64(code, i, f->address) :
+          image.machine == elf_symbols::x86_64 ?
+          decode_x86_64(code.data() + i, code.size() - i, f->address + i) :
+          instruction_t{};
+
+        if (instruction.length == 0) {
+          size.decoded = false;
+          break;
+        }
+
+        uint64_t const ip = f->address + i;
+        if (instruction.kind == instruction_t::branch) {
+          if (instruction.conditional)
+            conditionals.push_back(ip);
+          if (instruction.target <= ip && instruction.target >= f->address)
+            loops.push_back({ instruction.target, ip });
+        }
+
+        ++size.instructions;
+        i += instruction.length;
+
+        elf_symbol_t const* const s = image.find(instruction.target);
+        if (!s || instruction.kind == instruction_t::other)
+          continue;
+        if (instruction.kind == instruction_t::branch && s->function &&
+          s->address == instruction.target)
+          pending.push_back(s->address);
+        else if (instruction.kind == instruction_t::data && !s->function &&
+          tables.insert(s->address).second) {
+          size.table_bytes += s->size;
+          size.symbols.push_back(s);
+        }
+      }
+
+      size.loop_branches += f->address == address ?
+        count_loop_branches(conditionals, loops) :
+        uint32_t(conditionals.size());
+    }
+
+    return size;
+  }
+
+  // The ELF file of this program (on Linux) or an empty image.
+  static elf_symbols const& self() {
+    static elf_symbols const image = elf_symbols::load("/proc/self/exe");
+    return image;
+  }
+
+  // Offset from addresses in self() to addresses in memory.
+  static uint64_t self_bias() {
+    elf_symbol_t const* const anchor = self().find("eaf_code_size_anchor");
+    return anchor ? reinterpret_cast<uintptr_t>(&eaf_code_size_anchor) -
+      anchor->address : 0;
+  }
+
+  /**
+   * As above for a function of this program. Returns an empty footprint
+   * (no functions) if self() is empty.
+   */
+  template <typename F>
+  static code_size_t measure(F* function) {
+    if (!self().find("eaf_code_size_anchor"))
+      return {};
+    return measure(self(), reinterpret_cast<uintptr_t>(function) -
+      self_bias());
+  }
+
+  /**
+   * Decodes the length of the x86-64 instruction at code, whose address is
+   * ip, and whether it is a direct branch or has a RIP-relative or absolute
+   * memory operand. Covers general purpose, x87, SSE, AVX and AVX-512
+   * encodings (as emitted by compilers) but not 3DNow! or XOP.
+   */
+  static instruction_t decode_x86_64(uint8_t const* code, size_t size,
+    uint64_t ip) {
+
+    instruction_t instruction;
+
+    size_t i = 0;
+    bool operand16 = false, rex_w = false;
+    auto const byte = [&](size_t j) -> int {
+      return j < size ? code[j] : -1;
+    };
+
+    // Legacy and REX prefixes:
+    for (;; ++i) {
+      int const b = byte(i);
+      if (b == 0x66)
+        operand16 = true;
+      else if (b != 0x67 && b != 0xf0 && b != 0xf2 && b != 0xf3 &&
+        b != 0x26 && b != 0x2e && b != 0x36 && b != 0x3e && b != 0x64 &&
+        b != 0x65)
+        break;
+    }
+    if ((byte(i) & 0xf0) == 0x40) {
+      rex_w = byte(i) & 8;
+      ++i;
+    }
+
+    uint32_t map = 0; // 0: one byte, 1: 0F, 2: 0F38, 3: 0F3A
+    int const b = byte(i);
+
+    if (b == 0xc5 || b == 0xc4 || b == 0x62) {
+      // VEX and EVEX, whose opcodes are followed by ModRM:
+      if (b == 0xc5) {
+        map = 1;
+        i += 2;
+      }
+      else {
+        if (byte(i + 1) < 0)
+          return {};
+        map = byte(i + 1) & (b == 0x62 ? 0x7 : 0x1f);
+        i += b == 0x62 ? 4 : 3;
+      }
+      if (map < 1 || map > 3)
+        return {};
+    }
+    else if (b == 0x0f) {
+      map = 1;
+      ++i;
+      if (byte(i) == 0x38) {
+        map = 2;
+        ++i;
+      }
+      else if (byte(i) == 0x3a) {
+        map = 3;
+        ++i;
+      }
+    }
+
+    int const op = byte(i++);
+    if (op < 0)
+      return {};
+
+    bool has_modrm = false;
+    uint32_t imm = 0;
+    bool rel = false;
+
+    uint32_t const imm_z = operand16 ? 2 : 4;
+
+    if (map == 0) {
+      if (op < 0x40) {
+        uint32_t const low = op & 7;
+        if (low > 5) // Prefixes or invalid
+          return {};
+        has_modrm = low < 4;
+        imm = low == 4 ? 1 : low == 5 ? imm_z : 0;
+      }
+      else if (op < 0x60) {         // push, pop
+      }
+      else if (op == 0x63)
+        has_modrm = true;
+      else if (op < 0x68)
+        return {};
+      else if (op == 0x68 || op == 0x69) {
+        has_modrm = op == 0x69;
+        imm = imm_z;
+      }
+      else if (op == 0x6a || op == 0x6b) {
+        has_modrm = op == 0x6b;
+        imm = 1;
+      }
+      else if (op < 0x70) {
+      }
+      else if (op < 0x80) {
+        imm = 1;
+        rel = true;
+      }
+      else if (op == 0x80 || op == 0x83) {
+        has_modrm = true;
+        imm = 1;
+      }
+      else if (op == 0x81) {
+        has_modrm = true;
+        imm = imm_z;
+      }
+      else if (op == 0x82)
+        return {};
+      else if (op < 0x90)
+        has_modrm = true;
+      else if (op < 0xa0) {
+      }
+      else if (op < 0xa4)           // mov with 64-bit moffs
+        imm = 8;
+      else if (op == 0xa8)
+        imm = 1;
+      else if (op == 0xa9)
+        imm = imm_z;
+      else if (op < 0xb0) {
+      }
+      else if (op < 0xb8)
+        imm = 1;
+      else if (op < 0xc0)
+        imm = rex_w ? 8 : imm_z;
+      else if (op == 0xc0 || op == 0xc1 || op == 0xc6) {
+        has_modrm = true;
+        imm = 1;
+      }
+      else if (op == 0xc7) {
+        has_modrm = true;
+        imm = imm_z;
+      }
+      else if (op == 0xc2 || op == 0xca)
+        imm = 2;
+      else if (op == 0xc8)
+        imm = 3;
+      else if (op == 0xcd)
+        imm = 1;
+      else if (op < 0xd0) {
+      }
+      else if (op < 0xd4 || (op >= 0xd8 && op < 0xe0))
+        has_modrm = true;
+      else if (op < 0xe0) {
+      }
+      else if (op < 0xe4 || op == 0xeb) {
+        imm = 1;
+        rel = true;
+      }
+      else if (op < 0xe8)
+        imm = 1;
+      else if (op == 0xe8 || op == 0xe9) {
+        imm = 4;
+        rel = true;
+      }
+      else if (op == 0xf6 || op == 0xf7 || op == 0xfe || op == 0xff) {
+        has_modrm = true;
+        // test r/m, imm:
+        if (op <= 0xf7 && (byte(i) >> 3 & 7) < 2)
+          imm = op == 0xf6 ? 1 : imm_z;
+      }
+    }
+    else if (map == 1) {
+      has_modrm = !(op == 0x05 || op == 0x06 || op == 0x07 || op == 0x08 ||
+        op == 0x09 || op == 0x0b || (op >= 0x30 && op < 0x38) ||
+        op == 0x77 || (op >= 0x80 && op < 0x90) || op == 0xa0 ||
+        op == 0xa1 || op == 0xa2 || op == 0xa8 || op == 0xa9 ||
+        (op >= 0xc8 && op < 0xd0));
+      if (op >= 0x80 && op < 0x90) {
+        imm = 4;
+        rel = true;
+      }
+      else if ((op >= 0x70 && op < 0x74) || op == 0xa4 || op == 0xac ||
+        op == 0xba || op == 0xc2 || (op >= 0xc4 && op < 0xc7))
+        imm = 1;
+    }
+    else {
+      has_modrm = true;
+      imm = map == 3 ? 1 : 0;
+    }
+
+    bool rip = false, absolute = false;
+    int64_t disp = 0;
+
+    if (has_modrm) {
+      int const modrm = byte(i++);
+      if (modrm < 0)
+        return {};
+      uint32_t const mod = modrm >> 6, rm = modrm & 7;
+      uint32_t disp_size = mod == 1 ? 1 : mod == 2 ? 4 : 0;
+      if (mod != 3 && rm == 4) {
+        int const sib = byte(i++);
+        if (sib < 0)
+          return {};
+        if (mod == 0 && (sib & 7) == 5) {
+          disp_size = 4;
+          absolute = true;
+        }
+      }
+      else if (mod == 0 && rm == 5) {
+        disp_size = 4;
+        rip = true;
+      }
+      if (i + disp_size > size)
+        return {};
+      disp = read_signed(code + i, disp_size);
+      i += disp_size;
+    }
+
+    if (i + imm > size || i + imm > 15)
+      return {};
+
+    instruction.length = uint32_t(i + imm);
+
+    if (rel) {
+      instruction.kind   = instruction_t::branch;
+      // jcc, loop and jrcxz rather than jmp and call:
+      instruction.conditional = map == 1 || op < 0xe8;
+      instruction.target = ip + instruction.length +
+        read_signed(code + i, imm);
+    }
+    else if (rip) {
+      instruction.kind   = instruction_t::data;
+      instruction.target = ip + instruction.length + disp;
+    }
+    else if (absolute) {
+      instruction.kind   = instruction_t::data;
+      instruction.target = uint64_t(disp);
+    }
+
+    return instruction;
+  }
+
+  /**
+   * Decodes the AArch64 instruction at code[i], whose function starts at
+   * base: every instruction has 4 bytes. Direct branches (B, BL, B.cond,
+   * CBZ, TBZ, ...) have targets, as do ADRP followed by ADD or LDR/STR of
+   * the same register.
+   */
+  static instruction_t decode_aarch64(std::vector<uint8_t> const& code,
+    size_t i, uint64_t base) {
+
+    instruction_t instruction;
+    if (i + 4 > code.size())
+      return instruction;
+    instruction.length = 4;
+
+    uint32_t const w = read_word(code, i);
+    uint64_t const ip = base + i;
+
+    auto const sext = [](uint64_t x, uint32_t bits) {
+      return int64_t(x << (64 - bits)) >> (64 - bits);
+    };
+
+    if ((w & 0x7c000000) == 0x14000000) {         // B, BL
+      instruction.kind   = instruction_t::branch;
+      instruction.target = ip + 4 * sext(w & 0x3ffffff, 26);
+    }
+    else if ((w & 0xff000010) == 0x54000000 ||    // B.cond
+      (w & 0x7e000000) == 0x34000000) {           // CBZ, CBNZ
+      instruction.kind   = instruction_t::branch;
+      instruction.conditional = true;
+      instruction.target = ip + 4 * sext(w >> 5 & 0x7ffff, 19);
+    }
+    else if ((w & 0x7e000000) == 0x36000000) {    // TBZ, TBNZ
+      instruction.kind   = instruction_t::branch;
+      instruction.conditional = true;
+      instruction.target = ip + 4 * sext(w >> 5 & 0x3fff, 14);
+    }
+    else if ((w & 0x9f000000) == 0x90000000 && i + 8 <= code.size()) {
+      // ADRP
+      uint64_t const page = (ip & ~uint64_t(0xfff)) + 4096 *
+        sext((w >> 3 & 0x1ffffc) | (w >> 29 & 3), 21);
+      uint32_t const next = read_word(code, i + 4);
+      uint32_t const reg  = w & 0x1f;
+      if ((next >> 5 & 0x1f) != reg)
+        return instruction;
+      if ((next & 0xffc00000) == 0x91000000)      // ADD (64-bit, imm)
+        instruction.target = page + (next >> 10 & 0xfff);
+      else if ((next & 0x3b000000) == 0x39000000) // LDR/STR (unsigned imm)
+        instruction.target = page + ((next >> 10 & 0xfff) << (next >> 30));
+      else
+        return instruction;
+      instruction.kind = instruction_t::data;
+    }
+
+    return instruction;
+  }
+
+private:
+
+  static uint32_t count_loop_branches(std::vector<uint64_t> const&
+    conditionals, std::vector<std::pair<uint64_t, uint64_t>> const& loops) {
+
+    auto const outermost = [&](std::pair<uint64_t, uint64_t> const& loop) {
+      for (auto const& other : loops)
+        if (other != loop && other.first <= loop.first &&
+          loop.second <= other.second)
+          return false;
+      return true;
+    };
+
+    uint32_t count = 0;
+    for (uint64_t ip : conditionals) {
+      bool in_loop = false, back_edge = false;
+      for (auto const& loop : loops) {
+        in_loop   |= loop.first <= ip && ip <= loop.second;
+        back_edge |= ip == loop.second && outermost(loop);
+      }
+      count += in_loop && !back_edge;
+    }
+    return count;
+  }
+
+  static int64_t read_signed(uint8_t const* p, uint32_t size) {
+    uint64_t value = 0;
+    for (uint32_t j = 0; j < size; ++j)
+      value |= uint64_t(p[j]) << (8 * j);
+    return size == 0 ? 0 : int64_t(value << (64 - 8 * size)) >>
+      (64 - 8 * size);
+  }
+
+  static uint32_t read_word(std::vector<uint8_t> const& code, size_t i) {
+    return uint32_t(code[i]) | uint32_t(code[i + 1]) << 8 |
+      uint32_t(code[i + 2]) << 16 | uint32_t(code[i + 3]) << 24;
+  }
+};
+
+#endif // EAF_UTIL_CODE_SIZE_HPP
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_DATE_FILTER_HPP
+#define EAF_UTIL_DATE_FILTER_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// A conjunction of calendar predicates, e.g., month == 2 is months = 1 << 2
+// and year BETWEEN 2000 AND 2010 is year_min = 2000 and year_max = 2010.
+struct date_predicate_t {
+  int32_t  year_min = INT32_MIN;  // Inclusive
+  int32_t  year_max = INT32_MAX;  // Inclusive
+  uint32_t months   = 0x1ffe;     // Bit m is set if month m is selected
+  uint32_t days     = 0xfffffffe; // Bit d is set if day d is selected
+};
+
+// Day numbers first to last, inclusive.
+struct day_interval_t {
+  int32_t first;
+  int32_t last;
+};
+
+struct date_filter {
+
+  // Calendar predicates pushed down to scans of day-number columns. At plan
+  // time, compile turns the predicate into the sorted disjoint intervals of
+  // the days it selects, using to_rata_die. The scan then tests membership
+  // of the raw day numbers, without decoding dates.
+  //
+  // Few intervals (e.g., year BETWEEN) are tested one by one. Otherwise,
+  // domains of up to 2^20 days (about 2870 years) get a bitmap of selected
+  // days, which the scan indexes. Larger ones binary search the interval
+  // boundaries with a fixed number of steps, in lockstep over a block of 64
+  // days. The three are branchless, but compilers vectorise the first at
+  // most, hence their AVX2 forms when built with it: unsigned comparisons,
+  // gathers of the bitmap's words and gathers of the boundaries, 8, 8 and 4
+  // days at a time, whose selections movemask packs into the block's mask.
+  // The remaining days, or all of them without AVX2, go through the scalar
+  // loops.
+
+  /**
+   * Compiles predicate for the days of domain, which bounds unbounded
+   * predicates, e.g., month == 2 is only expanded for the years of domain.
+   *
+   * @tparam A      Algorithm with to_date and to_rata_die, whose epoch is
+   *                that of the column.
+   */
+  template <typename A = benjoffe_fast64>
+  static date_filter compile(date_predicate_t const& predicate,
+    day_interval_t domain) {
+
+    date_filter filter;
+
+    date32_t const date_first = A::to_date(domain.first);
+    date32_t const date_last  = A::to_date(domain.last);
+    int32_t  const year_min   = std::max(predicate.year_min, date_first.year);
+    int32_t  const year_max   = std::min(predicate.year_max, date_last.year);
+
+    auto const add = [&](int64_t first, int64_t last) {
+      first = std::max<int64_t>(first, domain.first);
+      last  = std::min<int64_t>(last, domain.last);
+      if (first > last)
+        return;
+      if (!filter.intervals_.empty() &&
+        filter.intervals_.back().last + int64_t(1) == first)
+        filter.intervals_.back().last = int32_t(last);
+      else
+        filter.intervals_.push_back({ int32_t(first), int32_t(last) });
+    };
+
+    // First day of the month, which might not be representable for the
+    // month of domain.first, hence counted from it.
+    auto const month_start = [&](int32_t year, uint32_t month) -> int64_t {
+      if (year == date_first.year && month == date_first.month)
+        return int64_t(domain.first) - (date_first.day - 1);
+      return A::to_rata_die(year, month, 1);
+    };
+
+    bool const all_months = (predicate.months & 0x1ffe) == 0x1ffe;
+    bool const all_days   = (predicate.days & 0xfffffffe) == 0xfffffffe;
+
+    if (all_months && all_days) {
+      if (year_min <= year_max) {
+        int64_t const first = year_min == date_first.year ? domain.first :
+          A::to_rata_die(year_min, 1, 1);
+        int64_t const last  = year_max == date_last.year ? domain.last :
+          int64_t(A::to_rata_die(year_max + 1, 1, 1)) - 1;
+        add(first, last);
+      }
+    }
+    else {
+      for (int64_t year = year_min; year <= year_max; ++year) {
+        for (uint32_t month = 1; month <= 12; ++month) {
+          if (!(predicate.months >> month & 1))
+            continue;
+          // Months outside domain might not be representable:
+          if ((year == date_first.year && month < date_first.month) ||
+            (year == date_last.year && month > date_last.month))
+            continue;
+          int64_t const first = month_start(int32_t(year), month);
+          uint32_t const length = last_day_of_month(int32_t(year), month);
+          if (all_days)
+            add(first, first + length - 1);
+          else
+            for (uint32_t day = 1; day <= length; ++day)
+              if (predicate.days >> day & 1)
+                add(first + day - 1, first + day - 1);
+        }
+      }
+    }
+
+    // Boundaries for the binary search: begins and ends (exclusive), padded
+    // to a power of two with a boundary greater than every day.
+    size_t size = 1;
+    while (size < 2 * filter.intervals_.size())
+      size *= 2;
+    filter.boundaries.assign(size, INT64_MAX);
+    for (size_t i = 0; i < filter.intervals_.size(); ++i) {
+      filter.boundaries[2 * i]     = filter.intervals_[i].first;
+      filter.boundaries[2 * i + 1] = filter.intervals_[i].last + int64_t(1);
+    }
+
+    // Bitmap of the selected days of domain:
+    uint64_t const days = uint64_t(int64_t(domain.last) - domain.first) + 1;
+    if (filter.intervals_.size() > linear_max && days <= bitmap_max) {
+      filter.bitmap.assign((days + 63) / 64, 0);
+      for (day_interval_t const& interval : filter.intervals_)
+        for (int64_t n = interval.first; n <= interval.last; ++n) {
+          uint64_t const i = uint64_t(n - domain.first);
+          filter.bitmap[i / 64] |= uint64_t(1) << (i % 64);
+        }
+      filter.domain = domain;
+    }
+
+    return filter;
+  }
+
+  /**
+   * Sets bit i % 64 of selection[i / 64] if, and only if, dayNumbers[i] is
+   * selected.
+   */
+  void select(int32_t const* dayNumbers, size_t count,
+    uint64_t* selection) const {
+
+    for (size_t i = 0; i < count; i += 64) {
+      size_t const end = std::min<size_t>(count - i, 64);
+      if (intervals_.size() <= linear_max)
+        selection[i / 64] = select_linear(dayNumbers + i, end);
+      else if (!bitmap.empty())
+        selection[i / 64] = select_bitmap(dayNumbers + i, end);
+      else
+        selection[i / 64] = select_search(dayNumbers + i, end);
+    }
+  }
+
+  // The sorted disjoint intervals of the selected days.
+  std::vector<day_interval_t> const& intervals() const { return intervals_; }
+
+private:
+
+  size_t   static constexpr linear_max = 8;
+  uint64_t static constexpr bitmap_max = uint64_t(1) << 20;
+
+  std::vector<day_interval_t> intervals_;
+  std::vector<int64_t>  boundaries;
+  std::vector<uint64_t> bitmap;
+  day_interval_t        domain = {};
+
+  static uint32_t last_day_of_month(int32_t year, uint32_t month) {
+    if (month == 2)
+      return 28 + (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0));
+    return 30 + ((month ^ (month >> 3)) & 1);
+  }
+
+#if defined(__AVX2__)
+
+  static __m256i set1(uint32_t c) { return _mm256_set1_epi32(int32_t(c)); }
+
+  static __m256i load(int32_t const* p) {
+    return _mm256_loadu_si256((__m256i const*) p);
+  }
+
+  // Unsigned a <= b:
+  static __m256i leu(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi32(_mm256_min_epu32(a, b), a);
+  }
+
+  // The sign bits of the 8 lanes of 32 bits, or of the 4 lanes of 64 bits:
+  static uint64_t movemask(__m256i m) {
+    return uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+  }
+  static uint64_t movemask64(__m256i m) {
+    return uint32_t(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+  }
+
+#endif // defined(__AVX2__)
+
+  // The selections of the count (at most 64) days from dayNumbers, as bits
+  // of a mask.
+
+  uint64_t select_linear(int32_t const* dayNumbers, size_t count) const {
+    uint64_t mask = 0;
+    size_t j = 0;
+#if defined(__AVX2__)
+    for (; j + 8 <= count; j += 8) {
+      __m256i const n = load(dayNumbers + j);
+      __m256i in = _mm256_setzero_si256();
+      for (day_interval_t const& interval : intervals_)
+        in = _mm256_or_si256(in, leu(_mm256_sub_epi32(n,
+          set1(interval.first)), set1(uint32_t(interval.last) -
+          uint32_t(interval.first))));
+      mask |= movemask(in) << j;
+    }
+#endif
+    for (; j < count; ++j) {
+      uint32_t in = 0;
+      for (day_interval_t const& interval : intervals_)
+        in |= uint32_t(dayNumbers[j]) - uint32_t(interval.first) <=
+          uint32_t(interval.last) - uint32_t(interval.first);
+      mask |= uint64_t(in) << j;
+    }
+    return mask;
+  }
+
+  // Days outside domain are not selected, which the unsigned comparison
+  // also guards the index with.
+  uint64_t select_bitmap(int32_t const* dayNumbers, size_t count) const {
+    uint32_t const span = uint32_t(domain.last) - uint32_t(domain.first);
+    uint64_t mask = 0;
+    size_t j = 0;
+#if defined(__AVX2__)
+    // On x86, little-endian, bit i of the bitmap is bit i % 32 of its
+    // (i / 32)-th 32-bit word, which the gathers load:
+    int const* const words = (int const*) bitmap.data();
+    for (; j + 8 <= count; j += 8) {
+      __m256i const i = _mm256_sub_epi32(load(dayNumbers + j),
+        set1(domain.first));
+      __m256i const in_domain = leu(i, set1(span));
+      __m256i const k = _mm256_and_si256(i, in_domain);
+      __m256i const word = _mm256_i32gather_epi32(words,
+        _mm256_srli_epi32(k, 5), 4);
+      // Bit k % 32 of the word to the sign bit:
+      __m256i const bit = _mm256_sllv_epi32(word,
+        _mm256_sub_epi32(set1(31), _mm256_and_si256(k, set1(31))));
+      mask |= movemask(_mm256_and_si256(bit, in_domain)) << j;
+    }
+#endif
+    for (; j < count; ++j) {
+      uint32_t const i = uint32_t(dayNumbers[j]) - uint32_t(domain.first);
+      uint32_t const in_domain = i <= span;
+      uint32_t const k = in_domain ? i : 0;
+      mask |= (in_domain & (bitmap[k / 64] >> (k % 64))) << j;
+    }
+    return mask;
+  }
+
+  // A day is selected if, and only if, an odd number of boundaries are not
+  // greater than it.
+  uint64_t select_search(int32_t const* dayNumbers, size_t count) const {
+    int64_t const* const b = boundaries.data();
+    uint64_t mask = 0;
+    size_t j = 0;
+#if defined(__AVX2__)
+    // In lockstep over groups of 4 days, for the gathers to overlap:
+    long long const* const p = (long long const*) b;
+    size_t const groups = count / 4;
+    __m256i n[16], pos_4[16];
+    for (size_t g = 0; g < groups; ++g) {
+      n[g] = _mm256_cvtepi32_epi64(_mm_loadu_si128(
+        (__m128i const*) (dayNumbers + 4 * g)));
+      pos_4[g] = _mm256_setzero_si256();
+    }
+    for (size_t step = boundaries.size() / 2; step >= 1; step /= 2) {
+      __m256i const s = _mm256_set1_epi64x(int64_t(step));
+      for (size_t g = 0; g < groups; ++g) {
+        __m256i const x = _mm256_i64gather_epi64(p + step - 1, pos_4[g], 8);
+        pos_4[g] = _mm256_add_epi64(pos_4[g], _mm256_andnot_si256(
+          _mm256_cmpgt_epi64(x, n[g]), s));
+      }
+    }
+    for (size_t g = 0; g < groups; ++g) {
+      __m256i const x = _mm256_i64gather_epi64(p, pos_4[g], 8);
+      // The parity of pos + (x <= n) is that of pos + (x > n), flipped:
+      mask |= (movemask64(_mm256_xor_si256(_mm256_slli_epi64(pos_4[g], 63),
+        _mm256_cmpgt_epi64(x, n[g]))) ^ 0xf) << 4 * g;
+    }
+    j = 4 * groups;
+#endif
+    uint32_t pos[64] = {};
+    for (size_t step = boundaries.size() / 2; step >= 1; step /= 2)
+      for (size_t k = j; k < count; ++k)
+        pos[k] += uint32_t(b[pos[k] + step - 1] <= dayNumbers[k]) * step;
+    for (size_t k = j; k < count; ++k)
+      mask |= uint64_t((pos[k] + (b[pos[k]] <= dayNumbers[k])) & 1) << k;
+    return mask;
+  }
+
+}; // struct date_filter
+
+#endif // EAF_UTIL_DATE_FILTER_HPP
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_DATE_TRUNC_HPP
+#define EAF_UTIL_DATE_TRUNC_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct date_trunc {
+
+  // Period truncation, as SQL's date_trunc, on day numbers: maps a day to
+  // the first day of its period. The kernels are members of the algorithms
+  // (e.g., benjoffe_fast64::to_month_start) since they reuse the
+  // intermediate values of to_date; this struct holds what they share and
+  // the batch forms.
+
+  enum period {
+    week,    // ISO week, starting on Monday
+    month,
+    quarter,
+    year,
+  };
+
+  /**
+   * Days from the first day of the quarter to the first day of the month.
+   */
+  static inline
+  uint32_t quarter_offset(uint32_t month, uint32_t leap) {
+    static uint8_t constexpr offsets[] = {
+      0, 0, 31, 59, 0, 30, 61, 0, 31, 62, 0, 31, 61,
+    };
+    return offsets[month] + (month == 3) * leap;
+  }
+
+  /**
+   * Truncates count day numbers to the first day of their periods. A is an
+   * algorithm providing the kernels, e.g., benjoffe_fast64.
+   */
+  template <period P, typename A>
+  static inline
+  void to_start(int32_t const* dayNumbers, int32_t* starts, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      int32_t const n = dayNumbers[i];
+      if constexpr (P == week)
+        starts[i] = A::to_week_start(n);
+      else if constexpr (P == month)
+        starts[i] = A::to_month_start(n);
+      else if constexpr (P == quarter)
+        starts[i] = A::to_quarter_start(n);
+      else
+        starts[i] = A::to_year_start(n);
+    }
+  }
+
+}; // struct date_trunc
+
+#endif // EAF_UTIL_DATE_TRUNC_HPP
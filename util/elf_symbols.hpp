@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_ELF_SYMBOLS_HPP
+#define EAF_UTIL_ELF_SYMBOLS_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// A symbol of the static symbol table (.symtab) of an ELF file.
+struct elf_symbol_t {
+  std::string name;
+  uint64_t    address;
+  uint64_t    size;
+  bool        function; // Otherwise, data (e.g., a table)
+};
+
+/**
+ * Minimal reader of 64-bit little-endian ELF files (e.g., x86-64 and
+ * AArch64 executables) for the sizes of functions and tables, and the bytes
+ * of functions. It does not depend on system headers: on other platforms,
+ * or for stripped files, load returns an empty image.
+ */
+struct elf_symbols {
+
+  uint16_t static constexpr x86_64  = 62;  // e_machine
+  uint16_t static constexpr aarch64 = 183;
+
+  uint16_t                  machine = 0;
+  std::vector<elf_symbol_t> symbols; // Sorted by address
+
+  bool empty() const {
+    return symbols.empty();
+  }
+
+  static elf_symbols load(char const* path) {
+
+    elf_symbols image;
+
+    std::ifstream file(path, std::ios::binary);
+    image.bytes.assign(std::istreambuf_iterator<char>(file),
+      std::istreambuf_iterator<char>());
+
+    std::vector<uint8_t> const& b = image.bytes;
+    if (b.size() < 64 || std::memcmp(b.data(), "\x7f" "ELF", 4) != 0 ||
+      b[4] != 2 || b[5] != 1) // ELFCLASS64, ELFDATA2LSB
+      return image;
+
+    image.machine = image.read<uint16_t>(18);
+
+    uint64_t const shoff     = image.read<uint64_t>(40);
+    uint16_t const shentsize = image.read<uint16_t>(58);
+    uint16_t const shnum     = image.read<uint16_t>(60);
+
+    for (uint16_t i = 0; i < shnum; ++i) {
+      uint64_t const sh = shoff + uint64_t(i) * shentsize;
+      if (sh + 64 > b.size())
+        return image;
+      image.sections.push_back({ image.read<uint32_t>(sh + 4),
+        image.read<uint64_t>(sh + 8), image.read<uint64_t>(sh + 16),
+        image.read<uint64_t>(sh + 24), image.read<uint64_t>(sh + 32),
+        image.read<uint32_t>(sh + 40) });
+    }
+
+    for (section_t const& s : image.sections) {
+      if (s.type != 2) // SHT_SYMTAB
+        continue;
+      if (s.link >= image.sections.size())
+        return image;
+      section_t const& strtab = image.sections[s.link];
+      for (uint64_t e = s.offset; e + 24 <= s.offset + s.size &&
+        e + 24 <= b.size(); e += 24) {
+        uint32_t const name  = image.read<uint32_t>(e);
+        uint8_t  const type  = b[e + 4] & 0xf;
+        uint16_t const shndx = image.read<uint16_t>(e + 6);
+        uint64_t const value = image.read<uint64_t>(e + 8);
+        uint64_t const size  = image.read<uint64_t>(e + 16);
+        // STT_OBJECT = 1 and STT_FUNC = 2, defined in this file:
+        if ((type != 1 && type != 2) || shndx == 0 || size == 0 ||
+          strtab.offset + name >= b.size())
+          continue;
+        auto const first = b.begin() + (strtab.offset + name);
+        image.symbols.push_back({ std::string(first,
+          std::find(first, b.end(), 0)), value, size, type == 2 });
+      }
+    }
+
+    std::sort(image.symbols.begin(), image.symbols.end(),
+      [](elf_symbol_t const& x, elf_symbol_t const& y) {
+        return x.address < y.address;
+      });
+
+    return image;
+  }
+
+  // Returns the symbol whose bytes contain address or nullptr.
+  elf_symbol_t const* find(uint64_t address) const {
+    auto const i = std::upper_bound(symbols.begin(), symbols.end(), address,
+      [](uint64_t a, elf_symbol_t const& s) { return a < s.address; });
+    if (i == symbols.begin())
+      return nullptr;
+    elf_symbol_t const& s = *std::prev(i);
+    return address - s.address < s.size ? &s : nullptr;
+  }
+
+  elf_symbol_t const* find(std::string const& name) const {
+    for (elf_symbol_t const& s : symbols)
+      if (s.name == name)
+        return &s;
+    return nullptr;
+  }
+
+  // Returns the bytes of symbol in the file or an empty vector if it has
+  // none (e.g., it is in .bss).
+  std::vector<uint8_t> code(elf_symbol_t const& symbol) const {
+    for (section_t const& s : sections) {
+      // Not SHF_ALLOC or SHT_NOBITS:
+      if (!(s.flags & 2) || s.type == 8 || symbol.address < s.address ||
+        symbol.address + symbol.size > s.address + s.size)
+        continue;
+      uint64_t const offset = s.offset + (symbol.address - s.address);
+      if (offset + symbol.size > bytes.size())
+        break;
+      return std::vector<uint8_t>(bytes.begin() + offset,
+        bytes.begin() + offset + symbol.size);
+    }
+    return {};
+  }
+
+private:
+
+  struct section_t {
+    uint32_t type;
+    uint64_t flags;
+    uint64_t address;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+  };
+
+  std::vector<uint8_t>   bytes;
+  std::vector<section_t> sections;
+
+  template <typename T>
+  T read(uint64_t offset) const {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T) && offset + i < bytes.size(); ++i)
+      value |= T(T(bytes[offset + i]) << (8 * i));
+    return value;
+  }
+};
+
+#endif // EAF_UTIL_ELF_SYMBOLS_HPP
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_EPOCH_HPP
+#define EAF_UTIL_EPOCH_HPP
+
+#include "eaf/date.hpp"
+#include "eaf/gregorian.hpp"
+
+#include <stdint.h>
+
+// Common epochs given as rata dies, i.e., days since 1 January 1970. These
+// are meant as the EPOCH template argument of the benjoffe algorithms, which
+// then take the number of days since the given epoch as input.
+struct epoch {
+  static int32_t constexpr unix_time =        0; // 1970-01-01
+  static int32_t constexpr dotnet    =  -719162; // 0001-01-01 (.NET DateTime)
+  static int32_t constexpr ole       =   -25569; // 1899-12-30 (Excel, OLE)
+  static int32_t constexpr mjd       =   -40587; // 1858-11-17 (Modified JD)
+  static int32_t constexpr jdn       = -2440588; // -4713-11-24 (Julian Day)
+
+  // Gregorian date of a rata die beyond the 32-bit range, e.g., for the date
+  // limits of the algorithms, which are computed at compile time.
+  static constexpr
+  date32_t gregorian_date(int64_t rata_die) {
+    eaf::date_t<int64_t> const date =
+      eaf::gregorian::to_date<int64_t>(rata_die + 719468);
+    return { int32_t(date.year), date.month, date.day };
+  }
+};
+
+#endif // EAF_UTIL_EPOCH_HPP
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_FRACTIONAL_DAY_HPP
+#define EAF_UTIL_FRACTIONAL_DAY_HPP
+
+#include "eaf/date.hpp"
+#include "algorithms/_portable_uint128.hpp"
+#include "algorithms/benjoffe_fast64.hpp"
+#include "util/epoch.hpp"
+
+#include <bit>
+#include <stddef.h>
+#include <stdint.h>
+
+struct day_time_t {
+  int32_t  day;        // days since the epoch of the input
+  uint64_t nanosecond; // nanosecond of day: 0 to 86400 * 10^9 - 1
+};
+
+struct fractional_day {
+
+  // Splits day counts given as doubles, e.g., Julian Dates and OLE
+  // Automation dates, into an integer day and a nanosecond of day, which
+  // then feed the integer algorithms.
+  //
+  // Precision: the result is exact for the binary value of the double, that
+  // is, the nanosecond is truncated (never rounded) and nothing is lost on
+  // the way. The double itself is only as precise as its last bit, e.g., a
+  // Julian Date in 2025 has a resolution of 2^-31 days (about 40 us.)
+  // Inputs must be finite with the day in the signed 32-bit range.
+  //
+  // With x = s * 2^-k, where s is the signed 53-bit significand, the day is
+  // s >> k (an arithmetic shift is a floor) and the fraction is the low k
+  // bits of s, scaled by 86400 * 10^9 with a 64x64-bit multiplication. Days
+  // within the signed 32-bit range have k >= 22. Magnitudes below 2^-11
+  // (k >= 64) are rare and take a separate path.
+
+  static uint64_t constexpr NS_PER_DAY = 86400000000000ull;
+
+  /**
+   * Splits x into floor(x) and the nanosecond of day of x - floor(x).
+   */
+  static inline
+  day_time_t split(double x) {
+
+    uint64_t const bits = std::bit_cast<uint64_t>(x);
+    uint32_t const exp  = uint32_t(bits >> 52) & 0x7ff;   // Biased exponent
+    uint32_t const k    = 1075 - exp;                     // x = sig * 2^-k
+
+    if (k >= 64)
+      return split_tiny(bits);
+
+    uint64_t const neg  = uint64_t(int64_t(bits) >> 63);  // All-ones if x < 0
+    uint64_t const mag  = (bits & SIG_MASK) | (SIG_MASK + 1);
+    int64_t  const sig  = int64_t((mag ^ neg) - neg);
+
+    // The low k bits as a 64-bit fixed-point fraction, which is exact, so
+    // the nanosecond is the high half of a single multiplication:
+    uint64_t const frac = uint64_t(sig) << ((64 - k) & 63);
+    uint64_t const ns   = uint64_t(uint128_t(frac) * NS_PER_DAY >> 64);
+
+    return { int32_t(sig >> k), ns };
+  }
+
+  /**
+   * Splits a Julian Date (days since noon of 24 November -4713) into the
+   * Julian Day Number of the civil date and the nanosecond since midnight.
+   */
+  static inline
+  day_time_t from_julian_date(double jd) {
+    day_time_t const split_jd = split(jd);
+    // Julian Dates start at noon:
+    uint64_t const ns = split_jd.nanosecond + NS_PER_DAY / 2;
+    uint64_t const next = -uint64_t(ns >= NS_PER_DAY);
+    return { split_jd.day - int32_t(next), ns - (next & NS_PER_DAY) };
+  }
+
+  /**
+   * Splits an OLE Automation date (days since 30 December 1899) into the
+   * day and the nanosecond of day. Negative dates hold the time of day as a
+   * positive fraction, e.g., -1.25 is 6:00 on 29 December 1899, so the day
+   * is x truncated towards zero.
+   */
+  static inline
+  day_time_t from_ole(double ole) {
+    uint64_t const bits = std::bit_cast<uint64_t>(ole);
+    uint64_t const sign = bits & (uint64_t(1) << 63);
+    day_time_t const abs = split(std::bit_cast<double>(bits ^ sign));
+    return { sign ? -abs.day : abs.day, abs.nanosecond };
+  }
+
+  // Batch forms of the above, followed by the date (Gregorian calendar) via
+  // the integer algorithm instantiated with the epoch of the input.
+
+  static inline
+  void from_julian_date(double const* jds, date32_t* dates,
+    uint64_t* nanoseconds, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      day_time_t const dt = from_julian_date(jds[i]);
+      dates[i] = benjoffe_fast64_jdn::to_date(dt.day);
+      nanoseconds[i] = dt.nanosecond;
+    }
+  }
+
+  static inline
+  void from_ole(double const* oles, date32_t* dates, uint64_t* nanoseconds,
+    size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      day_time_t const dt = from_ole(oles[i]);
+      dates[i] = benjoffe_fast64_ole::to_date(dt.day);
+      nanoseconds[i] = dt.nanosecond;
+    }
+  }
+
+private:
+
+  static uint64_t constexpr SIG_MASK = (uint64_t(1) << 52) - 1;
+
+  // |x| < 2^-11, including zeros and subnormals: the day is 0 or -1. With
+  // P = mag * NS_PER_DAY < 2^100, the nanosecond is floor(P / 2^k) or
+  // NS_PER_DAY - ceil(P / 2^k), where ceil(P / 2^k) = floor((P - 1) / 2^k)
+  // + 1 and P - 1 only borrows from the high half if the low half is 0.
+  static inline
+  day_time_t split_tiny(uint64_t bits) {
+
+    uint32_t const exp = uint32_t(bits >> 52) & 0x7ff;
+    uint64_t const mag = (bits & SIG_MASK) | (uint64_t(exp != 0) << 52);
+    uint64_t const neg = -((bits >> 63) & (mag != 0));
+    // Subnormals are at the same scale as exp = 1:
+    uint32_t const k   = 1075 - exp - (exp == 0);
+
+    uint128_t const P  = uint128_t(mag) * NS_PER_DAY;
+    uint64_t const hi  = hi128(P) - (neg & uint64_t(lo128(P) == 0));
+    uint64_t const ns  = hi >> ((k < 127 ? k : 127) - 64);
+
+    return { int32_t(neg), (neg & (NS_PER_DAY - 1 - 2 * ns)) + ns };
+  }
+
+}; // struct fractional_day
+
+#endif // EAF_UTIL_FRACTIONAL_DAY_HPP
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_HISTOGRAM_HPP
+#define EAF_UTIL_HISTOGRAM_HPP
+
+#include "algorithms/benjoffe_fast32.hpp"
+#include "eaf/bounds.hpp"
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Bins of a histogram by month: months consecutive months starting in
+// January of year.
+struct month_range_t {
+  int32_t  year;
+  uint32_t months;
+};
+
+/**
+ * The bins of day numbers, i.e., min(A::to_month_index(n) - base, months)
+ * as uint32_t, with months for days outside the range.
+ *
+ * Specialised below for benjoffe_fast32_t without bounds checks.
+ */
+template <typename A>
+struct month_bins {
+
+  static inline
+  void fill(int32_t const* dayNumbers, uint32_t* bins, size_t count,
+    uint32_t base, uint32_t months) {
+    for (size_t i = 0; i < count; ++i)
+      bins[i] = std::min(uint32_t(A::to_month_index(dayNumbers[i])) - base,
+        months);
+  }
+};
+
+/**
+ * As above by the decoding of benjoffe_fast32_t::to_month_index, which does
+ * not depend on VARIANT. Built with AVX-512F or AVX2, 16 or 8 days at a time
+ * go through the same steps, with the 32x32-bit high products as
+ * _mm512_mul_epu32 (or _mm256_mul_epu32) on the even and odd lanes, see
+ * bins_lanes. Compilers vectorise the scalar form with 64-bit products
+ * instead, if at all. The remaining days, or all of them without AVX2, go
+ * through the scalar form.
+ */
+template <int32_t EPOCH, typename VARIANT>
+struct month_bins<benjoffe_fast32_t<EPOCH, eaf::bounds::unchecked, VARIANT>> {
+
+  using A = benjoffe_fast32_t<EPOCH, eaf::bounds::unchecked, VARIANT>;
+
+  static inline
+  void fill(int32_t const* dayNumbers, uint32_t* bins, size_t count,
+    uint32_t base, uint32_t months) {
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + avx512_t::lanes <= count; i += avx512_t::lanes)
+      bins_lanes<avx512_t>(dayNumbers + i, bins + i, base, months);
+#endif
+#if defined(__AVX2__)
+    for (; i + avx2_t::lanes <= count; i += avx2_t::lanes)
+      bins_lanes<avx2_t>(dayNumbers + i, bins + i, base, months);
+#endif
+    for (; i < count; ++i)
+      bins[i] = std::min(uint32_t(A::to_month_index(dayNumbers[i])) - base,
+        months);
+  }
+
+private:
+
+#if defined(__AVX2__)
+
+  // The operations of bins_lanes on registers of 32-bit lanes.
+
+  struct avx2_t {
+
+    using reg_t  = __m256i;
+    using mask_t = __m256i;
+
+    static size_t constexpr lanes = 8;
+
+    static reg_t set1(uint32_t c) { return _mm256_set1_epi32(int32_t(c)); }
+
+    static reg_t add(reg_t a, reg_t b) { return _mm256_add_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm256_sub_epi32(a, b); }
+    static reg_t mul(reg_t a, reg_t b) { return _mm256_mullo_epi32(a, b); }
+    static reg_t min(reg_t a, reg_t b) { return _mm256_min_epu32(a, b); }
+
+    // High halves of the 64-bit products, by the even and odd lanes:
+    static reg_t mulhi(reg_t a, reg_t b) {
+      reg_t const even = _mm256_mul_epu32(a, b);
+      reg_t const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+      return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    }
+
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm256_srli_epi32(a, n); }
+
+    static mask_t gt(reg_t a, reg_t b) { return _mm256_cmpgt_epi32(a, b); }
+
+    static reg_t add_if(reg_t x, mask_t m, reg_t c) {
+      return add(x, _mm256_and_si256(m, c));
+    }
+
+    static reg_t load(int32_t const* p) {
+      return _mm256_loadu_si256((__m256i const*) p);
+    }
+    static void store(uint32_t* p, reg_t a) {
+      _mm256_storeu_si256((__m256i*) p, a);
+    }
+  };
+
+#endif // defined(__AVX2__)
+
+#if defined(__AVX512F__)
+
+  struct avx512_t {
+
+    using reg_t  = __m512i;
+    using mask_t = __mmask16;
+
+    static size_t constexpr lanes = 16;
+
+    static reg_t set1(uint32_t c) { return _mm512_set1_epi32(int32_t(c)); }
+
+    // The zero-masking forms, with all lanes, where GCC 12 warns of the
+    // undefined source of the others when inlined (a false positive):
+    static reg_t add(reg_t a, reg_t b) { return _mm512_add_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm512_sub_epi32(a, b); }
+    static reg_t mul(reg_t a, reg_t b) { return _mm512_mullo_epi32(a, b); }
+    static reg_t min(reg_t a, reg_t b) {
+      return _mm512_maskz_min_epu32(0xFFFF, a, b);
+    }
+
+    static reg_t mulhi(reg_t a, reg_t b) {
+      reg_t const even = _mm512_maskz_mul_epu32(0xFF, a, b);
+      reg_t const odd  = _mm512_maskz_mul_epu32(0xFF,
+        _mm512_maskz_srli_epi64(0xFF, a, 32), b);
+      return _mm512_mask_blend_epi32(0xAAAA,
+        _mm512_maskz_srli_epi64(0xFF, even, 32), odd);
+    }
+
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm512_maskz_srli_epi32(0xFFFF, a, n); }
+
+    static mask_t gt(reg_t a, reg_t b) { return _mm512_cmpgt_epi32_mask(a, b); }
+
+    static reg_t add_if(reg_t x, mask_t m, reg_t c) {
+      return _mm512_mask_add_epi32(x, m, x, c);
+    }
+
+    static reg_t load(int32_t const* p) { return _mm512_loadu_si512(p); }
+    static void store(uint32_t* p, reg_t a) { _mm512_storeu_si512(p, a); }
+  };
+
+#endif // defined(__AVX512F__)
+
+#if defined(__AVX2__)
+
+  // A::parts, without the day, and the bins of V::lanes days. Products wrap
+  // modulo 2^32 as in the scalar form.
+  template <typename V>
+  static inline
+  void bins_lanes(int32_t const* dayNumbers, uint32_t* bins, uint32_t base,
+    uint32_t months) {
+    using reg_t = typename V::reg_t;
+    reg_t const rev = V::sub(V::set1(A::D_SHIFT), V::load(dayNumbers));
+    reg_t const cen = V::template srli<15>(V::mulhi(rev, V::set1(A::C1)));
+    reg_t const jul = V::sub(V::add(rev, cen), V::template srli<2>(cen));
+    reg_t const yrs = V::template srli<8>(V::mulhi(jul, V::set1(A::C2)));
+    reg_t const rem = V::sub(jul,
+      V::template srli<2>(V::mul(yrs, V::set1(1461))));
+    // rem < 1461, hence the signed comparison:
+    typename V::mask_t const early = V::gt(V::set1(60), rem);
+    reg_t const shift = V::add_if(V::set1(979360), early,
+      V::set1(uint32_t(192928 - 979360)));
+    reg_t const month = V::template srli<16>(V::sub(shift,
+      V::mul(rem, V::set1(2141))));
+    // 12 * (Y_SHIFT - yrs + early) + month - 1 - base:
+    reg_t const index = V::add(V::mul(V::sub(V::set1(A::Y_SHIFT), yrs),
+      V::set1(12)), V::sub(month, V::set1(1 + base)));
+    V::store(bins, V::min(V::add_if(index, early, V::set1(12)),
+      V::set1(months)));
+  }
+
+#endif // defined(__AVX2__)
+};
+
+/**
+ * Adds to counts[i] the number of day numbers in the i-th month of range.
+ * Days outside the range are ignored.
+ *
+ * Day numbers go straight to bins by A::to_month_index, without dates. The
+ * bins of a block are computed first, by month_bins<A>, whose vector form
+ * does 8 or 16 days at a time, then counted into interleaved tables, so
+ * consecutive increments of the same bin do not wait on each other.
+ * Out-of-range days go to an extra bin rather than to a branch.
+ *
+ * @tparam A        Algorithm with to_month_index, e.g., benjoffe_fast32.
+ *                  Day numbers must be in its range.
+ */
+template <typename A = benjoffe_fast32>
+void
+histogram_by_month(int32_t const* dayNumbers, size_t count,
+  month_range_t range, uint32_t* counts) {
+
+  size_t   static constexpr block  = 1024;
+  uint32_t static constexpr tables = 4;
+
+  uint32_t const months = range.months;
+  uint32_t const stride = months + 1; // Extra bin for out of range.
+  uint32_t const base   = uint32_t(range.year) * 12;
+
+  std::vector<uint32_t> local(tables * stride);
+  uint32_t bins[block];
+
+  for (size_t i = 0; i < count; i += block) {
+    size_t const end = std::min(count - i, block);
+
+    month_bins<A>::fill(dayNumbers + i, bins, end, base, months);
+
+    size_t j = 0;
+    for (; j + tables <= end; j += tables)
+      for (uint32_t t = 0; t < tables; ++t)
+        ++local[t * stride + bins[j + t]];
+    for (; j < end; ++j)
+      ++local[bins[j]];
+  }
+
+  for (uint32_t t = 0; t < tables; ++t)
+    for (uint32_t m = 0; m < months; ++m)
+      counts[m] += local[t * stride + m];
+}
+
+/**
+ * As above with the input split among threads, each counting into its own
+ * table. The tables are added to counts at the end.
+ */
+template <typename A = benjoffe_fast32>
+void
+histogram_by_month(int32_t const* dayNumbers, size_t count,
+  month_range_t range, uint32_t* counts, unsigned threads) {
+
+  if (threads <= 1) {
+    histogram_by_month<A>(dayNumbers, count, range, counts);
+    return;
+  }
+
+  std::vector<std::vector<uint32_t>> tables(threads,
+    std::vector<uint32_t>(range.months));
+  std::vector<std::thread> workers;
+
+  size_t const chunk = (count + threads - 1) / threads;
+  for (unsigned t = 0; t < threads; ++t) {
+    size_t const begin = std::min(count, t * chunk);
+    size_t const size  = std::min(count - begin, chunk);
+    workers.emplace_back([=, &tables] {
+      histogram_by_month<A>(dayNumbers + begin, size, range,
+        tables[t].data());
+    });
+  }
+
+  for (unsigned t = 0; t < threads; ++t) {
+    workers[t].join();
+    for (uint32_t m = 0; m < range.months; ++m)
+      counts[m] += tables[t][m];
+  }
+}
+
+#endif // EAF_UTIL_HISTOGRAM_HPP
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_MONTH_RUNS_HPP
+#define EAF_UTIL_MONTH_RUNS_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Elements begin to end (exclusive) of a sorted column, all in the month
+// 12 * year + month - 1, as A::to_month_index.
+struct month_run_t {
+  int32_t month;
+  size_t  begin;
+  size_t  end;
+};
+
+/**
+ * Returns the runs of days in the same month of a column sorted in
+ * non-decreasing order, e.g., the groups of a rollup by month.
+ *
+ * Only the first day of each run is decoded. The first day of the next
+ * month is encoded by A::to_rata_die and the end of the run is found by
+ * galloping, i.e., probing 1, 2, 4, ... elements ahead and then binary
+ * searching the last step. The cost is O(runs * log(run length)) rather
+ * than O(count).
+ *
+ * @tparam A        Algorithm with to_date and to_rata_die, whose epoch is
+ *                  that of the column.
+ */
+template <typename A = benjoffe_fast64>
+std::vector<month_run_t>
+month_runs(int32_t const* sortedDays, size_t count) {
+
+  std::vector<month_run_t> runs;
+
+  for (size_t begin = 0; begin < count; ) {
+
+    date32_t const date  = A::to_date(sortedDays[begin]);
+    int32_t  const month = date.year * 12 + int32_t(date.month) - 1;
+
+    // The month following date_max's is not representable and neither is
+    // any day after it:
+    size_t end = count;
+
+    if (date.year != A::date_max.year || date.month != A::date_max.month) {
+
+      int32_t const next = date.month == 12 ?
+        A::to_rata_die(date.year + 1, 1, 1) :
+        A::to_rata_die(date.year, date.month + 1, 1);
+
+      // Gallop: sortedDays[lo] < next and next <= sortedDays[hi] if hi is
+      // not past the end.
+      size_t lo   = begin;
+      size_t step = 1;
+      while (step < count - lo && sortedDays[lo + step] < next) {
+        lo   += step;
+        step *= 2;
+      }
+      size_t const hi = lo + std::min(step, count - lo);
+
+      end = std::lower_bound(sortedDays + lo + 1, sortedDays + hi, next) -
+        sortedDays;
+    }
+
+    runs.push_back({ month, begin, end });
+    begin = end;
+  }
+
+  return runs;
+}
+
+#endif // EAF_UTIL_MONTH_RUNS_HPP
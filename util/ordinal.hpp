@@ -12,4 +12,9 @@ struct ordinal32_t {
   bool leap;
 };
 
+struct month_day_t {
+  uint32_t month;   // 1-indexed
+  uint32_t day;     // 1-indexed
+};
+
 #endif // ORDINAL_HPP
\ No newline at end of file
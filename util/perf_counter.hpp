@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_PERF_COUNTER_HPP
+#define EAF_UTIL_PERF_COUNTER_HPP
+
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * A hardware event counter of this thread, in user space, by Linux's
+ * perf_event_open. Elsewhere, or without access to the counters (e.g., in
+ * virtual machines or with kernel.perf_event_paranoid > 2), valid() is
+ * false and read() returns 0.
+ */
+struct perf_counter {
+
+  enum event_t {
+    branch_misses,
+    branch_instructions,
+    instructions,
+  };
+
+  explicit perf_counter(event_t event) {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = event == branch_misses ?
+      PERF_COUNT_HW_BRANCH_MISSES : event == branch_instructions ?
+      PERF_COUNT_HW_BRANCH_INSTRUCTIONS : PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    (void) event;
+#endif
+  }
+
+  perf_counter(perf_counter const&) = delete;
+  perf_counter& operator =(perf_counter const&) = delete;
+
+  ~perf_counter() {
+#if defined(__linux__)
+    if (valid())
+      close(fd);
+#endif
+  }
+
+  bool valid() const {
+    return fd >= 0;
+  }
+
+  // Resets the count to 0 and starts counting.
+  void start() {
+#if defined(__linux__)
+    if (valid()) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  void stop() {
+#if defined(__linux__)
+    if (valid())
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+  }
+
+  uint64_t read() const {
+    uint64_t count = 0;
+#if defined(__linux__)
+    if (valid() && ::read(fd, &count, sizeof(count)) != sizeof(count))
+      count = 0;
+#endif
+    return count;
+  }
+
+private:
+
+  int fd = -1;
+};
+
+#endif // EAF_UTIL_PERF_COUNTER_HPP
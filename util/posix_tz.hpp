@@ -0,0 +1,382 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_POSIX_TZ_HPP
+#define EAF_UTIL_POSIX_TZ_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * UTC to local time by a POSIX TZ rule string, e.g., "CET-1CEST,M3.5.0,
+ * M10.5.0/3", as glibc's localtime_r with TZ set to it (without the
+ * zoneinfo lookup): the rules of a UTC year decide the offsets in it. Unlike
+ * glibc, which uses the transitions of 1970 for all earlier years, rules
+ * apply to every year.
+ *
+ * The transitions of first_year to last_year are computed once, by
+ * benjoffe_fast64::to_rata_die and benjoffe_fast64::weekday, and cached. They
+ * are then laid out in buckets of 2^shift seconds, with shift as large as
+ * possible while no bucket holds more than one change of offset. A bucket
+ * has the change and the offsets before and after it, so that in range the
+ * offset is a shift, a load, a compare and a select. Out of range, the year
+ * is found by benjoffe_fast64::to_date and its transitions computed.
+ *
+ * Offsets are in seconds east of UTC, i.e., of opposite sign to the TZ
+ * string's. Without rules, DST follows the US ones (M3.2.0,M11.1.0), as
+ * glibc's built-in default. Times of rules may be negative and up to 167
+ * hours, as in RFC 9636. Leading colons, i.e., implementation-defined
+ * strings, are rejected.
+ */
+struct posix_tz {
+
+  // The transitions of a year, in UTC seconds since 1 January 1970.
+  struct transitions_t {
+    int64_t dst_start;
+    int64_t dst_end;
+  };
+
+  /**
+   * Parses tz and precomputes the transitions of first_year to last_year.
+   * Throws std::invalid_argument if tz is malformed.
+   */
+  explicit
+  posix_tz(char const* tz, int32_t first_year = 1900,
+    int32_t last_year = 2100) {
+    parse(tz);
+    cache(first_year, last_year);
+  }
+
+  std::string const& std_name() const { return std_name_; }
+  std::string const& dst_name() const { return dst_name_; }
+  int32_t std_offset() const { return std_offset_; }
+  int32_t dst_offset() const { return dst_offset_; }
+  bool    has_dst()    const { return has_dst_; }
+
+  transitions_t transitions(int32_t year) const {
+    if (year >= first_year_ && year < first_year_ + int32_t(years_.size()))
+      return years_[size_t(year - first_year_)];
+    return compute(year);
+  }
+
+  int32_t offset(int64_t utc) const {
+    uint64_t const rel = uint64_t(utc - t0_);
+    if (rel < span_) {
+      bucket_t const& b = buckets_[rel >> shift_];
+      uint32_t const at = uint32_t(rel & mask_);
+      return at < b.at ? b.before : b.after;
+    }
+    return offset_slow(utc);
+  }
+
+  bool is_dst(int64_t utc) const {
+    return has_dst_ && offset(utc) == dst_offset_;
+  }
+
+  int64_t to_local(int64_t utc) const {
+    return utc + offset(utc);
+  }
+
+  // Batch form of the above. In range, rows cost a compare and select and
+  // one load from a table of a few KiB.
+  void to_local(int64_t const* utc, int64_t* local, size_t count) const {
+    for (size_t i = 0; i < count; ++i)
+      local[i] = to_local(utc[i]);
+  }
+
+private:
+
+  using A = benjoffe_fast64;
+
+  // When the rule's date and time fall, see POSIX.1-2024 TZ.
+  struct rule_t {
+    enum kind_t {
+      julian1,         // Jn:    day n in [1, 365], 29 February not counted
+      julian0,         // n:     day n in [0, 365], 29 February counted
+      month_week_day,  // Mm.w.d: day d of week w in [1, 5] of month m
+    };
+    kind_t   kind;
+    uint32_t day;      // n or d (0 = Sunday)
+    uint32_t month;
+    uint32_t week;     // 5 = last
+    int32_t  time;     // local seconds after midnight
+  };
+
+  // Offsets before and after at seconds from the start of the bucket. If
+  // there is no change in it, before == after.
+  struct bucket_t {
+    uint32_t at;
+    int32_t  before;
+    int32_t  after;
+  };
+
+  // Buckets are never shorter than 2^min_shift seconds (18 hours), for the
+  // table to stay small. Rules with closer changes take offset_slow.
+  static uint32_t constexpr min_shift = 16;
+  static uint32_t constexpr max_shift = 31;
+
+  std::string std_name_;
+  std::string dst_name_;
+  int32_t     std_offset_ = 0;
+  int32_t     dst_offset_ = 0;
+  bool        has_dst_    = false;
+  rule_t      start_      = {};
+  rule_t      end_        = {};
+
+  int32_t                    first_year_ = 0;
+  std::vector<transitions_t> years_;
+
+  int64_t               t0_    = 0;
+  uint64_t              span_  = 0;  // 0 if all rows take offset_slow
+  uint32_t              shift_ = max_shift;
+  uint32_t              mask_  = 0;
+  std::vector<bucket_t> buckets_;
+
+  [[noreturn]] static inline
+  void invalid() {
+    throw std::invalid_argument("Invalid POSIX TZ string.");
+  }
+
+  static inline
+  bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  static inline
+  bool is_alpha(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+  }
+
+  static inline
+  uint32_t number(char const*& p, uint32_t max) {
+    if (!is_digit(*p))
+      invalid();
+    uint32_t n = 0;
+    while (is_digit(*p)) {
+      n = 10 * n + uint32_t(*p++ - '0');
+      if (n > max)
+        invalid();
+    }
+    return n;
+  }
+
+  // std or dst: 3 or more letters, or <...> with letters, digits, + and -.
+  static inline
+  std::string name(char const*& p) {
+    char const* const begin = p;
+    if (*p == '<') {
+      while (is_alpha(*++p) || is_digit(*p) || *p == '+' || *p == '-') {}
+      if (*p != '>' || p - begin < 4)
+        invalid();
+      return std::string(begin + 1, p++);
+    }
+    while (is_alpha(*p))
+      ++p;
+    if (p - begin < 3)
+      invalid();
+    return std::string(begin, p);
+  }
+
+  // [+|-]hh[:mm[:ss]] in seconds.
+  static inline
+  int32_t hms(char const*& p, uint32_t max_hours) {
+    int32_t const sign = *p == '-' ? -1 : 1;
+    if (*p == '+' || *p == '-')
+      ++p;
+    uint32_t seconds = 3600 * number(p, max_hours);
+    if (*p == ':') {
+      seconds += 60 * number(++p, 59);
+      if (*p == ':')
+        seconds += number(++p, 59);
+    }
+    return sign * int32_t(seconds);
+  }
+
+  static inline
+  rule_t rule(char const*& p) {
+    rule_t r = {};
+    if (*p == 'J') {
+      r.kind = rule_t::julian1;
+      r.day  = number(++p, 365);
+      if (r.day == 0)
+        invalid();
+    }
+    else if (*p == 'M') {
+      r.kind  = rule_t::month_week_day;
+      r.month = number(++p, 12);
+      if (r.month == 0 || *p++ != '.')
+        invalid();
+      r.week = number(p, 5);
+      if (r.week == 0 || *p++ != '.')
+        invalid();
+      r.day = number(p, 6);
+    }
+    else {
+      r.kind = rule_t::julian0;
+      r.day  = number(p, 365);
+    }
+    r.time = *p == '/' ? hms(++p, 167) : 7200;
+    return r;
+  }
+
+  void parse(char const* p) {
+    if (p == nullptr || *p == ':')
+      invalid();
+    std_name_   = name(p);
+    std_offset_ = -hms(p, 24);
+    if (*p == '\0')
+      return;
+    has_dst_    = true;
+    dst_name_   = name(p);
+    dst_offset_ = *p != '\0' && *p != ',' ? -hms(p, 24) : std_offset_ + 3600;
+    if (*p == '\0') {
+      char const* us = ",M3.2.0,M11.1.0";
+      parse_rules(us);
+    }
+    else
+      parse_rules(p);
+  }
+
+  void parse_rules(char const*& p) {
+    if (*p++ != ',')
+      invalid();
+    start_ = rule(p);
+    if (*p++ != ',')
+      invalid();
+    end_ = rule(p);
+    if (*p != '\0')
+      invalid();
+  }
+
+  static inline
+  bool is_leap(int32_t year) {
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+  }
+
+  static inline
+  int32_t rata_die(rule_t const& r, int32_t year) {
+    if (r.kind == rule_t::julian1)
+      return A::to_rata_die(year, 1, 1) + int32_t(r.day) - 1 +
+        (is_leap(year) && r.day >= 60);
+    if (r.kind == rule_t::julian0)
+      return A::to_rata_die(year, 1, 1) + int32_t(r.day);
+    int32_t const first = A::to_rata_die(year, r.month, 1);
+    // r.day counts from Sunday and A::weekday from Monday:
+    int32_t n = first + int32_t((r.day + 6 - A::weekday(first)) % 7 +
+      7 * (r.week - 1));
+    if (r.week == 5) {
+      int32_t const next = r.month == 12 ? A::to_rata_die(year + 1, 1, 1) :
+        A::to_rata_die(year, r.month + 1, 1);
+      if (n >= next)
+        n -= 7;
+    }
+    return n;
+  }
+
+  transitions_t compute(int32_t year) const {
+    return {
+      86400 * int64_t(rata_die(start_, year)) + start_.time - std_offset_,
+      86400 * int64_t(rata_die(end_, year)) + end_.time - dst_offset_,
+    };
+  }
+
+  // The offset at utc by the transitions of its year.
+  int32_t offset_in(transitions_t const& t, int64_t utc) const {
+    if (!has_dst_)
+      return std_offset_;
+    bool const dst = t.dst_start < t.dst_end ?
+      utc >= t.dst_start && utc < t.dst_end :
+      utc >= t.dst_start || utc < t.dst_end;
+    return dst ? dst_offset_ : std_offset_;
+  }
+
+  int32_t offset_slow(int64_t utc) const {
+    int64_t const days = utc / 86400 - (utc % 86400 < 0);
+    int32_t const year = A::to_date(int32_t(days)).year;
+    return offset_in(transitions(year), utc);
+  }
+
+  void cache(int32_t first_year, int32_t last_year) {
+
+    first_year_ = first_year;
+    years_.clear();
+    for (int32_t year = first_year; year <= last_year; ++year)
+      years_.push_back(compute(year));
+
+    // Changes of offset, in order: transitions within their year and year
+    // starts where the offset differs from the end of the previous year.
+    struct change_t {
+      int64_t utc;
+      int32_t before;
+      int32_t after;
+    };
+    std::vector<change_t> changes;
+
+    int64_t const t0 = 86400 * int64_t(A::to_rata_die(first_year, 1, 1));
+    int64_t const t1 = 86400 * int64_t(A::to_rata_die(last_year + 1, 1, 1));
+    int32_t const initial = offset_in(years_.front(), t0);
+    int32_t current = initial;
+
+    for (int32_t year = first_year; year <= last_year; ++year) {
+      transitions_t const& t = years_[size_t(year - first_year)];
+      int64_t const begin = 86400 * int64_t(A::to_rata_die(year, 1, 1));
+      int64_t const end   = 86400 * int64_t(A::to_rata_die(year + 1, 1, 1));
+      int64_t points[] = { begin, t.dst_start, t.dst_end };
+      if (points[1] > points[2])
+        std::swap(points[1], points[2]);
+      for (int64_t const utc : points) {
+        if (utc < begin || utc >= end)
+          continue;
+        int32_t const after = offset_in(t, utc);
+        if (after != current)
+          changes.push_back({ utc, current, after });
+        current = after;
+      }
+    }
+
+    // The largest shift that puts changes in different buckets:
+    uint32_t shift = max_shift;
+    for (size_t i = 1; i < changes.size(); ++i) {
+      int64_t const gap = changes[i].utc - changes[i - 1].utc;
+      while (shift >= min_shift && gap < (int64_t(1) << shift))
+        --shift;
+    }
+
+    buckets_.clear();
+    span_ = 0;
+    if (shift < min_shift || t1 <= t0)
+      return;
+
+    t0_    = t0;
+    shift_ = shift;
+    mask_  = uint32_t((uint64_t(1) << shift) - 1);
+    span_  = uint64_t(t1 - t0);
+
+    size_t const count = size_t((span_ + mask_) >> shift);
+    buckets_.assign(count, bucket_t{ 0, initial, initial });
+    int32_t offset = initial;
+    size_t  next   = 0;
+    for (size_t i = 0; i < count; ++i) {
+      int64_t const begin = t0 + (int64_t(i) << shift);
+      bucket_t& b = buckets_[i];
+      b = { 0, offset, offset };
+      if (next < changes.size() &&
+        changes[next].utc - begin <= int64_t(mask_)) {
+        b = { uint32_t(changes[next].utc - begin), changes[next].before,
+          changes[next].after };
+        offset = changes[next].after;
+        ++next;
+      }
+    }
+  }
+
+}; // struct posix_tz
+
+#endif // EAF_UTIL_POSIX_TZ_HPP
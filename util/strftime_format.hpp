@@ -0,0 +1,445 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_STRFTIME_FORMAT_HPP
+#define EAF_UTIL_STRFTIME_FORMAT_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/time_of_day.hpp"
+
+#include <stddef.h>
+#include <stdexcept>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/**
+ * Formats seconds since 1 January 1970 as strftime does, in the C locale, on
+ * the broken-down time given by gmtime_r. (Local seconds, e.g., those of
+ * posix_tz::to_local, format as local time.)
+ *
+ * The format is compiled once into a list of ops: runs of literal text and
+ * single conversions, with %c, %D, %F, %r, %R, %T, %x and %X expanded. Runs
+ * of up to 8 characters are kept in their ops and written by one store. Only
+ * the fields that the ops use are decoded, by benjoffe_fast64::to_date (and
+ * to_year_start, for the day of the year) and time_of_day::from_seconds.
+ * Numbers are written without tables, by mul-shifts valid on their ranges:
+ *
+ *     n / 10  == 103 * n / 2^10,  for all n in [0, 179[,
+ *     n / 100 == 41 * n / 2^12,   for all n in [0, 1099[,
+ *     n / 100 == 5243 * n / 2^19, for all n in [0, 43699[.
+ *
+ * Supported conversions are %a %A %b %B %C %d %e %g %G %h %H %I %j %k %l %m
+ * %M %n %p %P %s %S %t %u %U %V %w %W %y %Y %% and the above. Others, %z and
+ * %Z (the offset is not known), flags, widths and the E and O modifiers
+ * throw std::invalid_argument. Years, %C and %G are written with as many
+ * digits as they have, as glibc does.
+ */
+struct strftime_format {
+
+  explicit
+  strftime_format(char const* format) {
+    compile(format);
+    for (op_t& op : ops_) {
+      max_size_ += op.kind == literal ? op.size : width(op.kind);
+      needs_    |= needs(op.kind);
+      if (op.kind == literal && op.size <= sizeof(op.chars)) {
+        op.kind = short_literal;
+        memcpy(op.chars, text_.data() + op.offset, op.size);
+      }
+    }
+    max_size_ += sizeof(op_t::chars) - 1;
+  }
+
+  // Upper bound of the size of a formatted row, plus the bytes that short
+  // literals, written 8 at a time, may overrun.
+  size_t max_size() const { return max_size_; }
+
+  // Writes seconds formatted to out, which must have max_size() bytes, and
+  // returns the size written. No null terminator is written.
+  size_t format(int64_t seconds, char* out) const {
+    fields_t const f = decode(seconds);
+    char* p = out;
+    for (op_t const& op : ops_)
+      p = write(op, f, p);
+    return size_t(p - out);
+  }
+
+  // Batch form of the above: the rows are written back to back to out, which
+  // must have count * max_size() bytes, and ends[i] is the offset in out
+  // past row i.
+  void format(int64_t const* seconds, size_t count, char* out,
+    size_t* ends) const {
+    size_t end = 0;
+    for (size_t i = 0; i < count; ++i) {
+      end += format(seconds[i], out + end);
+      ends[i] = end;
+    }
+  }
+
+private:
+
+  enum kind_t : uint8_t {
+    literal,
+    short_literal, // of up to 8 characters
+    weekday_abbr,  // %a
+    weekday_name,  // %A
+    month_abbr,    // %b, %h
+    month_name,    // %B
+    century,       // %C
+    mday,          // %d
+    mday_space,    // %e
+    iso_year2,     // %g
+    iso_year,      // %G
+    hour24,        // %H
+    hour12,        // %I
+    yday,          // %j
+    hour24_space,  // %k
+    hour12_space,  // %l
+    month,         // %m
+    minute,        // %M
+    am_pm,         // %p
+    am_pm_lower,   // %P
+    epoch,         // %s
+    second,        // %S
+    wday_monday,   // %u
+    week_sunday,   // %U
+    iso_week,      // %V
+    wday_sunday,   // %w
+    week_monday,   // %W
+    year2,         // %y
+    year,          // %Y
+  };
+
+  struct op_t {
+    kind_t   kind;
+    uint16_t size;     // of a literal
+    uint32_t offset;   // of a literal in text_
+    char     chars[8]; // a short literal
+  };
+
+  enum need_t : uint8_t {
+    need_date    = 1,
+    need_time    = 2,
+    need_weekday = 4,
+    need_yday    = 8,
+  };
+
+  struct fields_t {
+    int64_t  seconds;
+    int32_t  year;
+    uint32_t month;
+    uint32_t day;
+    uint32_t hour;
+    uint32_t minute;
+    uint32_t second;
+    uint32_t weekday; // 0 = Sunday
+    uint32_t yday;    // 0-indexed
+  };
+
+  std::vector<op_t> ops_;
+  std::string       text_;
+  size_t            max_size_ = 0;
+  uint8_t           needs_    = 0;
+
+  static char constexpr weekdays[7][10] = { "Sunday", "Monday", "Tuesday",
+    "Wednesday", "Thursday", "Friday", "Saturday" };
+  static char constexpr months[12][10] = { "January", "February", "March",
+    "April", "May", "June", "July", "August", "September", "October",
+    "November", "December" };
+
+  [[noreturn]] static inline
+  void unsupported(char const* format, char c) {
+    throw std::invalid_argument(std::string("Unsupported conversion %") + c +
+      " in \"" + format + "\".");
+  }
+
+  void push(kind_t kind) {
+    ops_.push_back({ kind, 0, 0, {} });
+  }
+
+  void append(char const* text, size_t size) {
+    if (size == 0)
+      return;
+    if (ops_.empty() || ops_.back().kind != literal ||
+      ops_.back().size + size > UINT16_MAX)
+      ops_.push_back({ literal, 0, uint32_t(text_.size()), {} });
+    text_.append(text, size);
+    ops_.back().size = uint16_t(ops_.back().size + size);
+  }
+
+  void compile(char const* format) {
+    char const* p = format;
+    while (*p) {
+      char const* const q = strchr(p, '%');
+      if (!q) {
+        append(p, strlen(p));
+        break;
+      }
+      append(p, size_t(q - p));
+      char const c = q[1];
+      p = q + 2;
+      switch (c) {
+        case 'a': push(weekday_abbr); break;
+        case 'A': push(weekday_name); break;
+        case 'b': case 'h': push(month_abbr); break;
+        case 'B': push(month_name); break;
+        case 'C': push(century); break;
+        case 'd': push(mday); break;
+        case 'e': push(mday_space); break;
+        case 'g': push(iso_year2); break;
+        case 'G': push(iso_year); break;
+        case 'H': push(hour24); break;
+        case 'I': push(hour12); break;
+        case 'j': push(yday); break;
+        case 'k': push(hour24_space); break;
+        case 'l': push(hour12_space); break;
+        case 'm': push(month); break;
+        case 'M': push(minute); break;
+        case 'p': push(am_pm); break;
+        case 'P': push(am_pm_lower); break;
+        case 's': push(epoch); break;
+        case 'S': push(second); break;
+        case 'u': push(wday_monday); break;
+        case 'U': push(week_sunday); break;
+        case 'V': push(iso_week); break;
+        case 'w': push(wday_sunday); break;
+        case 'W': push(week_monday); break;
+        case 'y': push(year2); break;
+        case 'Y': push(year); break;
+        case 'n': append("\n", 1); break;
+        case 't': append("\t", 1); break;
+        case '%': append("%", 1); break;
+        // Composites, as in the C locale:
+        case 'c': compile("%a %b %e %H:%M:%S %Y"); break;
+        case 'D': case 'x': compile("%m/%d/%y"); break;
+        case 'F': compile("%Y-%m-%d"); break;
+        case 'r': compile("%I:%M:%S %p"); break;
+        case 'R': compile("%H:%M"); break;
+        case 'T': case 'X': compile("%H:%M:%S"); break;
+        case '\0':
+          throw std::invalid_argument(std::string("Trailing % in \"") +
+            format + "\".");
+        default: unsupported(format, c);
+      }
+    }
+  }
+
+  static inline
+  size_t width(kind_t kind) {
+    switch (kind) {
+      case weekday_name: case month_name: return 9;
+      case century:                       return 9;
+      case iso_year: case year:           return 11;
+      case epoch:                         return 20;
+      case yday: case weekday_abbr: case month_abbr: return 3;
+      case wday_monday: case wday_sunday: return 1;
+      default:                            return 2;
+    }
+  }
+
+  static inline
+  uint8_t needs(kind_t kind) {
+    switch (kind) {
+      case literal: case short_literal: case epoch:
+        return 0;
+      case hour24: case hour12: case hour24_space: case hour12_space:
+      case minute: case second: case am_pm: case am_pm_lower:
+        return need_time;
+      case weekday_abbr: case weekday_name: case wday_monday:
+      case wday_sunday:
+        return need_weekday;
+      case yday:
+        return need_yday;
+      case week_sunday: case week_monday: case iso_week: case iso_year:
+      case iso_year2:
+        return need_date | need_weekday | need_yday;
+      default:
+        return need_date;
+    }
+  }
+
+  fields_t decode(int64_t seconds) const {
+    fields_t f = {};
+    f.seconds = seconds;
+    int32_t const days = int32_t(seconds / 86400 - (seconds % 86400 < 0));
+    if (needs_ & need_date) {
+      date32_t const date = benjoffe_fast64::to_date(days);
+      f.year  = date.year;
+      f.month = date.month;
+      f.day   = date.day;
+    }
+    if (needs_ & need_time) {
+      hms_t const hms = time_of_day::from_seconds(uint32_t(seconds -
+        86400 * int64_t(days)));
+      f.hour   = hms.hour;
+      f.minute = hms.minute;
+      f.second = hms.second;
+    }
+    if (needs_ & need_weekday) // from Monday = 0 to Sunday = 0:
+      f.weekday = (benjoffe_fast64::weekday(days) + 1) % 7;
+    if (needs_ & need_yday)
+      f.yday = uint32_t(days - benjoffe_fast64::to_year_start(days));
+    return f;
+  }
+
+  // n in [0, 100[ as 2 digits.
+  static inline
+  char* two_digits(uint32_t n, char* p) {
+    uint32_t const tens = n * 103 >> 10;
+    p[0] = char('0' + tens);
+    p[1] = char('0' + n - 10 * tens);
+    return p + 2;
+  }
+
+  // n in [0, 100[ as 2 characters, padded with a space.
+  static inline
+  char* two_spaced(uint32_t n, char* p) {
+    uint32_t const tens = n * 103 >> 10;
+    p[0] = tens ? char('0' + tens) : ' ';
+    p[1] = char('0' + n - 10 * tens);
+    return p + 2;
+  }
+
+  // n in [0, 1000[ as 3 digits.
+  static inline
+  char* three_digits(uint32_t n, char* p) {
+    uint32_t const hundreds = n * 41 >> 12;
+    p[0] = char('0' + hundreds);
+    return two_digits(n - 100 * hundreds, p + 1);
+  }
+
+  // n with as many digits as it has, and a sign if negative. Years in
+  // [1000, 10000[ take 4 digits straight.
+  static inline
+  char* integer(int64_t n, char* p) {
+    if (n >= 1000 && n < 10000) {
+      uint32_t const hundreds = uint32_t(n) * 5243 >> 19;
+      p = two_digits(hundreds, p);
+      return two_digits(uint32_t(n) - 100 * hundreds, p);
+    }
+    uint64_t u = uint64_t(n);
+    if (n < 0) {
+      *p++ = '-';
+      u = 0 - u;
+    }
+    char buffer[20];
+    char* q = buffer + sizeof(buffer);
+    do {
+      *--q = char('0' + u % 10);
+      u /= 10;
+    } while (u);
+    size_t const size = size_t(buffer + sizeof(buffer) - q);
+    memcpy(p, q, size);
+    return p + size;
+  }
+
+  static inline
+  char* text(char const* s, size_t size, char* p) {
+    memcpy(p, s, size);
+    return p + size;
+  }
+
+  static inline
+  char* name(char const* s, char* p) {
+    return text(s, strlen(s), p);
+  }
+
+  // Floored year / 100 and year % 100:
+  static inline
+  int32_t floor_century(int32_t y) {
+    return y / 100 - (y % 100 < 0);
+  }
+
+  static inline
+  uint32_t floor_mod100(int32_t y) {
+    return uint32_t(y - 100 * floor_century(y));
+  }
+
+  static inline
+  bool is_leap(int32_t y) {
+    return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+  }
+
+  // ISO 8601 year has 53 weeks iff it starts on a Thursday, or on a
+  // Wednesday in a leap year.
+  static inline
+  uint32_t iso_weeks(uint32_t jan1, bool leap) {
+    return jan1 == 4 || (leap && jan1 == 3) ? 53 : 52;
+  }
+
+  // ISO 8601 week and its year.
+  static inline
+  uint32_t iso(fields_t const& f, int32_t* iso_y) {
+    uint32_t const monday_based = (f.weekday + 6) % 7;
+    uint32_t const week = (f.yday + 10 - monday_based) / 7;
+    uint32_t const jan1 = (f.weekday + 7 * 53 - f.yday) % 7;
+    *iso_y = f.year;
+    if (week == 0) {
+      bool const leap = is_leap(f.year - 1);
+      *iso_y = f.year - 1;
+      return iso_weeks((jan1 + (leap ? 5 : 6)) % 7, leap);
+    }
+    if (week == 53 && iso_weeks(jan1, is_leap(f.year)) == 52) {
+      *iso_y = f.year + 1;
+      return 1;
+    }
+    return week;
+  }
+
+  char* write(op_t const& op, fields_t const& f, char* p) const {
+    switch (op.kind) {
+      case literal:      return text(text_.data() + op.offset, op.size, p);
+      case weekday_abbr: return text(weekdays[f.weekday], 3, p);
+      case weekday_name: return name(weekdays[f.weekday], p);
+      case month_abbr:   return text(months[f.month - 1], 3, p);
+      case month_name:   return name(months[f.month - 1], p);
+      case century:      return integer(floor_century(f.year), p);
+      case mday:         return two_digits(f.day, p);
+      case mday_space:   return two_spaced(f.day, p);
+      case hour24:       return two_digits(f.hour, p);
+      case hour12:       return two_digits((f.hour + 11) % 12 + 1, p);
+      case yday:         return three_digits(f.yday + 1, p);
+      case hour24_space: return two_spaced(f.hour, p);
+      case hour12_space: return two_spaced((f.hour + 11) % 12 + 1, p);
+      case month:        return two_digits(f.month, p);
+      case minute:       return two_digits(f.minute, p);
+      case am_pm:        return text(f.hour < 12 ? "AM" : "PM", 2, p);
+      case am_pm_lower:  return text(f.hour < 12 ? "am" : "pm", 2, p);
+      case epoch:        return integer(f.seconds, p);
+      case second:       return two_digits(f.second, p);
+      case wday_monday:  *p = char('0' + (f.weekday + 6) % 7 + 1);
+                         return p + 1;
+      case wday_sunday:  *p = char('0' + f.weekday);
+                         return p + 1;
+      case week_sunday:  return two_digits((f.yday + 7 - f.weekday) / 7, p);
+      case week_monday:  return two_digits((f.yday + 7 - (f.weekday + 6) %
+                           7) / 7, p);
+      case year2:        return two_digits(floor_mod100(f.year), p);
+      case year:         return integer(f.year, p);
+      case short_literal:
+        memcpy(p, op.chars, sizeof(op.chars));
+        return p + op.size;
+      case iso_week: {
+        int32_t y;
+        return two_digits(iso(f, &y), p);
+      }
+      case iso_year: {
+        int32_t y;
+        iso(f, &y);
+        return integer(y, p);
+      }
+      case iso_year2: {
+        int32_t y;
+        iso(f, &y);
+        return two_digits(floor_mod100(y), p);
+      }
+    }
+    return p;
+  }
+
+}; // struct strftime_format
+
+#endif // EAF_UTIL_STRFTIME_FORMAT_HPP
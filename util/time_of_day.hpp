@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_TIME_OF_DAY_HPP
+#define EAF_UTIL_TIME_OF_DAY_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+struct hms_t {
+  uint32_t hour;
+  uint32_t minute;
+  uint32_t second;
+  uint32_t millisecond; // 0 when splitting seconds
+};
+
+struct time_of_day {
+
+  // Splits seconds of day, in [0, 86400), and milliseconds of day, in
+  // [0, 86400000), into hour, minute, second (and millisecond) with the
+  // mul-shifts of Examples 14 and 16 [1], valid on these ranges only.
+  //
+  // The hour is n / 3600 == 1193047 * n / 2^32 and the low 32 bits of the
+  // product, f, are the fraction of the hour elapsed: n % 3600 == 3600 * f /
+  // 2^32. Rather than multiplying f back by 3600 and dividing by 60 (with
+  // 71582789 / 2^32), the minute is the high half of 60 * f and the second
+  // that of 60 times its low half. tests/time_of_day_tests.cpp checks all
+  // inputs; the chain first fails at n = 2255761.
+  //
+  // For milliseconds, the seconds are
+  //
+  //     n / 1000 == 68719477 * n / 2^36, for all n in [0, 86400000[,
+  //
+  // found by the same search as example_14's, and the milliseconds are n
+  // minus 1000 times these. Inputs out of range have unspecified results.
+  //
+  //     [1] Neri C, and Schneider L, "Euclidean Affine Functions and their
+  //     Application to Calendar Algorithms" (2022).
+
+  static inline
+  hms_t from_seconds(uint32_t seconds) {
+    uint64_t const h = uint64_t(1193047) * seconds;
+    uint64_t const m = uint64_t(60) * uint32_t(h);
+    uint64_t const s = uint64_t(60) * uint32_t(m);
+    return { uint32_t(h >> 32), uint32_t(m >> 32), uint32_t(s >> 32), 0 };
+  }
+
+  static inline
+  hms_t from_milliseconds(uint32_t milliseconds) {
+    uint32_t const seconds = uint32_t(uint64_t(68719477) * milliseconds >>
+      36);
+    hms_t hms = from_seconds(seconds);
+    hms.millisecond = milliseconds - 1000 * seconds;
+    return hms;
+  }
+
+  // Batch forms of the above into columns. Built with AVX-512F or AVX2, 16
+  // or 8 rows at a time go through the same products, as _mm256_mul_epu32
+  // (or _mm512_mul_epu32) on the even and odd lanes (compilers do not find
+  // these in the scalar forms, and widen to 64 bits instead), see
+  // seconds_lanes and milliseconds_lanes. The remaining rows, or all of
+  // them without AVX2, go through the scalar forms.
+
+  static inline
+  void from_seconds(uint32_t const* seconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs, size_t count) {
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + avx512_t::lanes <= count; i += avx512_t::lanes)
+      seconds_lanes<avx512_t>(seconds + i, hours + i, minutes + i, secs + i);
+#endif
+#if defined(__AVX2__)
+    for (; i + avx2_t::lanes <= count; i += avx2_t::lanes)
+      seconds_lanes<avx2_t>(seconds + i, hours + i, minutes + i, secs + i);
+#endif
+    for (; i < count; ++i) {
+      hms_t const hms = from_seconds(seconds[i]);
+      hours[i]   = uint8_t(hms.hour);
+      minutes[i] = uint8_t(hms.minute);
+      secs[i]    = uint8_t(hms.second);
+    }
+  }
+
+  static inline
+  void from_milliseconds(uint32_t const* milliseconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs, uint16_t* millis, size_t count) {
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + avx512_t::lanes <= count; i += avx512_t::lanes)
+      milliseconds_lanes<avx512_t>(milliseconds + i, hours + i, minutes + i,
+        secs + i, millis + i);
+#endif
+#if defined(__AVX2__)
+    for (; i + avx2_t::lanes <= count; i += avx2_t::lanes)
+      milliseconds_lanes<avx2_t>(milliseconds + i, hours + i, minutes + i,
+        secs + i, millis + i);
+#endif
+    for (; i < count; ++i) {
+      hms_t const hms = from_milliseconds(milliseconds[i]);
+      hours[i]   = uint8_t(hms.hour);
+      minutes[i] = uint8_t(hms.minute);
+      secs[i]    = uint8_t(hms.second);
+      millis[i]  = uint16_t(hms.millisecond);
+    }
+  }
+
+private:
+
+#if defined(__AVX2__)
+
+  // The operations of the batch forms on registers of 32-bit lanes. mul
+  // multiplies the low halves of the 64-bit lanes, odd moves the odd lanes
+  // to these, and high gathers the high halves of the 64-bit products of
+  // the even and odd lanes.
+
+  struct avx2_t {
+
+    using reg_t = __m256i;
+
+    static size_t constexpr lanes = 8;
+
+    static reg_t set1(uint32_t c) { return _mm256_set1_epi32(int32_t(c)); }
+    static reg_t load(uint32_t const* p) {
+      return _mm256_loadu_si256((__m256i const*) p);
+    }
+
+    static reg_t mul(reg_t a, reg_t b) { return _mm256_mul_epu32(a, b); }
+    static reg_t odd(reg_t a) { return _mm256_srli_epi64(a, 32); }
+    static reg_t high(reg_t even, reg_t odd) {
+      return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    }
+
+    static reg_t mullo(reg_t a, reg_t b) { return _mm256_mullo_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm256_sub_epi32(a, b); }
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm256_srli_epi32(a, n); }
+
+    static void store(reg_t h, reg_t m, reg_t s, uint8_t* hours,
+      uint8_t* minutes, uint8_t* secs) {
+      // Per 128-bit half, 4 hours, 4 minutes and twice 4 seconds, then
+      // 8 hours, 8 minutes and twice 8 seconds:
+      __m256i const bytes = _mm256_packus_epi16(_mm256_packus_epi32(h, m),
+        _mm256_packus_epi32(s, s));
+      __m256i const columns = _mm256_permutevar8x32_epi32(bytes,
+        _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+      __m128i const lo = _mm256_castsi256_si128(columns);
+      _mm_storel_epi64((__m128i*) hours, lo);
+      _mm_storel_epi64((__m128i*) minutes, _mm_unpackhi_epi64(lo, lo));
+      _mm_storel_epi64((__m128i*) secs,
+        _mm256_extracti128_si256(columns, 1));
+    }
+
+    static void store(reg_t ms, uint16_t* millis) {
+      _mm_storeu_si128((__m128i*) millis, _mm256_castsi256_si128(
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(ms, ms), 0x08)));
+    }
+  };
+
+#endif // defined(__AVX2__)
+
+#if defined(__AVX512F__)
+
+  struct avx512_t {
+
+    using reg_t = __m512i;
+
+    static size_t constexpr lanes = 16;
+
+    static reg_t set1(uint32_t c) { return _mm512_set1_epi32(int32_t(c)); }
+    static reg_t load(uint32_t const* p) { return _mm512_loadu_si512(p); }
+
+    // The zero-masking forms, with all lanes, as GCC 12 warns of the
+    // undefined source of the others when inlined (a false positive):
+    static reg_t mul(reg_t a, reg_t b) {
+      return _mm512_maskz_mul_epu32(0xFF, a, b);
+    }
+    static reg_t odd(reg_t a) { return _mm512_maskz_srli_epi64(0xFF, a, 32); }
+    static reg_t high(reg_t even, reg_t odd) {
+      return _mm512_mask_blend_epi32(0xAAAA, avx512_t::odd(even), odd);
+    }
+
+    static reg_t mullo(reg_t a, reg_t b) { return _mm512_mullo_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b) { return _mm512_sub_epi32(a, b); }
+    template <int n>
+    static reg_t srli(reg_t a) { return _mm512_maskz_srli_epi32(0xFFFF, a, n); }
+
+    // Narrowing stores, which write all 16 lanes:
+    static void store(reg_t h, reg_t m, reg_t s, uint8_t* hours,
+      uint8_t* minutes, uint8_t* secs) {
+      _mm512_mask_cvtepi32_storeu_epi8(hours, 0xFFFF, h);
+      _mm512_mask_cvtepi32_storeu_epi8(minutes, 0xFFFF, m);
+      _mm512_mask_cvtepi32_storeu_epi8(secs, 0xFFFF, s);
+    }
+
+    static void store(reg_t ms, uint16_t* millis) {
+      _mm512_mask_cvtepi32_storeu_epi16(millis, 0xFFFF, ms);
+    }
+  };
+
+#endif // defined(__AVX512F__)
+
+#if defined(__AVX2__)
+
+  // High 32 bits of the products by c of the 32-bit lanes, given as the
+  // low halves of the 64-bit lanes of n_even and n_odd. The products go to
+  // lo_even and lo_odd, whose low halves are in turn inputs of mulhi.
+  template <typename V>
+  static inline
+  typename V::reg_t mulhi(typename V::reg_t const n_even,
+    typename V::reg_t const n_odd, typename V::reg_t const c,
+    typename V::reg_t* lo_even, typename V::reg_t* lo_odd) {
+    *lo_even = V::mul(n_even, c);
+    *lo_odd  = V::mul(n_odd, c);
+    return V::high(*lo_even, *lo_odd);
+  }
+
+  // from_seconds of V::lanes lanes into 3 columns.
+  template <typename V>
+  static inline
+  void store(typename V::reg_t const n, uint8_t* hours, uint8_t* minutes,
+    uint8_t* secs) {
+    using reg_t = typename V::reg_t;
+    reg_t const sixty = V::set1(60);
+    reg_t f_even, f_odd;
+    reg_t const h = mulhi<V>(n, V::odd(n), V::set1(1193047), &f_even,
+      &f_odd);
+    reg_t const m = mulhi<V>(f_even, f_odd, sixty, &f_even, &f_odd);
+    reg_t const s = mulhi<V>(f_even, f_odd, sixty, &f_even, &f_odd);
+    V::store(h, m, s, hours, minutes, secs);
+  }
+
+  template <typename V>
+  static inline
+  void seconds_lanes(uint32_t const* seconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs) {
+    store<V>(V::load(seconds), hours, minutes, secs);
+  }
+
+  template <typename V>
+  static inline
+  void milliseconds_lanes(uint32_t const* milliseconds, uint8_t* hours,
+    uint8_t* minutes, uint8_t* secs, uint16_t* millis) {
+    using reg_t = typename V::reg_t;
+    reg_t const n = V::load(milliseconds);
+    reg_t lo_even, lo_odd;
+    reg_t const s = V::template srli<4>(mulhi<V>(n, V::odd(n),
+      V::set1(68719477), &lo_even, &lo_odd));
+    reg_t const ms = V::sub(n, V::mullo(s, V::set1(1000)));
+    store<V>(s, hours, minutes, secs);
+    V::store(ms, millis);
+  }
+
+#endif // defined(__AVX2__)
+
+}; // struct time_of_day
+
+#endif // EAF_UTIL_TIME_OF_DAY_HPP
@@ -0,0 +1,371 @@
+// SPDX-License-Identifier: BSL-1.0
+// Copyright (c) 2025 Ben Joffe - https://www.benjoffe.com/fast-date-64
+
+#ifndef EAF_UTIL_TZIF_HPP
+#define EAF_UTIL_TZIF_HPP
+
+#include "algorithms/benjoffe_fast64.hpp"
+#include "eaf/date.hpp"
+#include "util/posix_tz.hpp"
+#include "util/time_of_day.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stddef.h>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Local broken-down time.
+struct local_time_t {
+  date32_t date;
+  uint32_t hour;
+  uint32_t minute;
+  uint32_t second;
+  int32_t  offset;  // seconds east of UTC
+  bool     is_dst;
+};
+
+/**
+ * UTC to local time by a TZif file (RFC 9636), e.g., /usr/share/zoneinfo/
+ * Europe/Berlin, as glibc's localtime_r with TZ set to its path.
+ *
+ * Version 1 files and the version 2+ data with 64-bit times are read. Times
+ * before the first transition take the first local time type. Times from
+ * the last transition on, or all times if there is none, follow the
+ * footer's TZ string, by posix_tz, or else the last (or first) type. Files
+ * with leap second records (the right/ zones) are rejected.
+ *
+ * Transitions are searched in Eytzinger order, i.e., as the breadth-first
+ * walk of a complete binary search tree stored in an array, so that the
+ * search has no data-dependent branches and its first levels share cache
+ * lines. Each node keeps the type in effect before its transition, so that
+ * the first transition after a time, which the search finds, gives the type
+ * of the time. Rows sorted in non-decreasing order can instead be merged
+ * with the transitions.
+ *
+ * The local seconds are broken down by benjoffe_fast64::to_date and
+ * time_of_day::from_seconds.
+ */
+struct tzif {
+
+  // Transitions of the footer's rules are added to the file's up to the end
+  // of this year, for most rows to take the same path.
+  static int32_t constexpr last_year = 2100;
+
+  /**
+   * Reads the file at path. Throws std::runtime_error if the file cannot be
+   * read and std::invalid_argument if it is malformed.
+   */
+  explicit
+  tzif(std::string const& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+      throw std::runtime_error("Cannot read " + path + ".");
+    std::vector<unsigned char> const data(
+      (std::istreambuf_iterator<char>(file)),
+      std::istreambuf_iterator<char>());
+    parse(data.data(), data.size());
+  }
+
+  /**
+   * Reads the TZif data of size bytes at data. Throws std::invalid_argument
+   * if it is malformed.
+   */
+  tzif(unsigned char const* data, size_t size) {
+    parse(data, size);
+  }
+
+  // The transitions, in UTC seconds since 1 January 1970, including those
+  // of the footer's rules up to the end of last_year.
+  std::vector<int64_t> const& transitions() const { return times_; }
+
+  // The footer's TZ string, empty if there is none.
+  std::string const& footer() const { return footer_; }
+
+  int32_t offset(int64_t utc) const {
+    return type(utc, search(utc)).offset;
+  }
+
+  local_time_t to_local_time(int64_t utc) const {
+    return local_time(utc, type(utc, search(utc)));
+  }
+
+  // Batch forms of the above on rows in any order. The searches of 8 rows
+  // go down the tree together, so that their loads overlap.
+  void to_local_time(int64_t const* utc, local_time_t* local,
+    size_t count) const {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+      size_t k[8] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+      while (k[0] < tree_.size())
+        for (size_t j = 0; j < 8; ++j)
+          k[j] = 2 * k[j] + (tree_[k[j]] <= utc[i + j]);
+      for (size_t j = 0; j < 8; ++j) {
+        uint32_t const node = uint32_t(k[j] >> (std::countr_one(k[j]) + 1));
+        local[i + j] = local_time(utc[i + j], type(utc[i + j], node));
+      }
+    }
+    for (; i < count; ++i)
+      local[i] = to_local_time(utc[i]);
+  }
+
+  // As above on rows sorted in non-decreasing order, merged with the
+  // transitions: O(count + transitions) rather than O(count * log
+  // transitions).
+  void to_local_time_sorted(int64_t const* utc, local_time_t* local,
+    size_t count) const {
+    size_t next = 0; // first transition after the row
+    for (size_t i = 0; i < count; ++i) {
+      int64_t const t = utc[i];
+      while (next < times_.size() && times_[next] <= t)
+        ++next;
+      uint32_t const node = next == times_.size() ? 0 : nodes_[next];
+      local[i] = local_time(t, type(t, node));
+    }
+  }
+
+private:
+
+  struct type_t {
+    int32_t offset;
+    bool    is_dst;
+  };
+
+  std::vector<type_t>  types_;
+  std::vector<int64_t> times_;  // in order
+  std::vector<uint8_t> after_;  // type from times_[i] on
+
+  // Eytzinger tree of times_, from index 1, and the type before each time.
+  // nodes_[i] is the index in the tree of times_[i].
+  std::vector<int64_t>  tree_;
+  std::vector<uint8_t>  before_;
+  std::vector<uint32_t> nodes_;
+
+  std::string             footer_;
+  std::optional<posix_tz> rule_;
+
+  [[noreturn]] static inline
+  void invalid() {
+    throw std::invalid_argument("Invalid TZif data.");
+  }
+
+  // Big-endian reader with bounds checks.
+  struct reader_t {
+
+    unsigned char const* p;
+    unsigned char const* end;
+
+    unsigned char const* take(size_t n) {
+      if (size_t(end - p) < n)
+        invalid();
+      unsigned char const* const q = p;
+      p += n;
+      return q;
+    }
+
+    uint32_t u32() {
+      unsigned char const* const q = take(4);
+      return uint32_t(q[0]) << 24 | uint32_t(q[1]) << 16 |
+        uint32_t(q[2]) << 8 | uint32_t(q[3]);
+    }
+
+    int64_t i64() {
+      uint64_t const hi = u32();
+      return int64_t(hi << 32 | u32());
+    }
+  };
+
+  struct header_t {
+    char     version;
+    uint32_t isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt;
+  };
+
+  static inline
+  header_t header(reader_t& r) {
+    unsigned char const* const magic = r.take(20);
+    if (magic[0] != 'T' || magic[1] != 'Z' || magic[2] != 'i' ||
+      magic[3] != 'f')
+      invalid();
+    header_t h;
+    h.version  = char(magic[4]);
+    h.isutcnt  = r.u32();
+    h.isstdcnt = r.u32();
+    h.leapcnt  = r.u32();
+    h.timecnt  = r.u32();
+    h.typecnt  = r.u32();
+    h.charcnt  = r.u32();
+    if (h.typecnt == 0 || h.typecnt > 256 || h.charcnt == 0)
+      invalid();
+    if ((h.isutcnt != 0 && h.isutcnt != h.typecnt) ||
+      (h.isstdcnt != 0 && h.isstdcnt != h.typecnt))
+      invalid();
+    if (h.leapcnt != 0)
+      throw std::invalid_argument("TZif leap seconds are not supported.");
+    return h;
+  }
+
+  // Reads a data block with times of time_size (4 or 8) bytes.
+  void block(reader_t& r, header_t const& h, size_t time_size) {
+
+    reader_t times = { r.take(size_t(h.timecnt) * time_size), r.p };
+    times_.resize(h.timecnt);
+    for (int64_t& t : times_)
+      t = time_size == 8 ? times.i64() : int64_t(int32_t(times.u32()));
+    for (size_t i = 1; i < times_.size(); ++i)
+      if (times_[i] <= times_[i - 1])
+        invalid();
+
+    unsigned char const* const indices = r.take(h.timecnt);
+    after_.assign(indices, indices + h.timecnt);
+    for (uint8_t const i : after_)
+      if (i >= h.typecnt)
+        invalid();
+
+    types_.resize(h.typecnt);
+    for (type_t& type : types_) {
+      type.offset = int32_t(r.u32());
+      unsigned char const* const q = r.take(2);
+      type.is_dst = q[0] != 0;
+      if (q[0] > 1 || q[1] >= h.charcnt || type.offset == INT32_MIN)
+        invalid();
+    }
+
+    r.take(size_t(h.charcnt) + h.isstdcnt + h.isutcnt);
+  }
+
+  void parse(unsigned char const* data, size_t size) {
+
+    reader_t r = { data, data + size };
+    header_t const v1 = header(r);
+
+    if (v1.version == '\0')
+      block(r, v1, 4);
+    else {
+      r.take(size_t(v1.timecnt) * 5 + size_t(v1.typecnt) * 6 + v1.charcnt +
+        v1.isstdcnt + v1.isutcnt);
+      header_t const v2 = header(r);
+      block(r, v2, 8);
+      // Footer: newline, TZ string (possibly empty), newline.
+      if (*r.take(1) != '\n')
+        invalid();
+      while (true) {
+        char const c = char(*r.take(1));
+        if (c == '\n')
+          break;
+        footer_ += c;
+      }
+      if (!footer_.empty()) {
+        rule_.emplace(footer_.c_str());
+        extend();
+      }
+    }
+
+    index();
+  }
+
+  // Adds the changes of offset of rule_ after the last transition up to the
+  // end of last_year, as found by rule_ itself. Without transitions, and
+  // past a change to a 257th type, which after_ cannot index, times are
+  // left to rule_, see type().
+  void extend() {
+
+    if (times_.empty() || !rule_->has_dst())
+      return;
+
+    int64_t const last = times_.back();
+    int32_t const first_year = benjoffe_fast64::to_date(int32_t(last /
+      86400 - (last % 86400 < 0))).year;
+
+    std::vector<int64_t> candidates;
+    for (int32_t year = first_year; year <= last_year; ++year) {
+      posix_tz::transitions_t const t = rule_->transitions(year);
+      candidates.push_back(86400 * int64_t(benjoffe_fast64::to_rata_die(year,
+        1, 1)));
+      candidates.push_back(t.dst_start);
+      candidates.push_back(t.dst_end);
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    type_t current = types_[after_.back()];
+    for (int64_t const t : candidates) {
+      if (t <= times_.back())
+        continue;
+      type_t const next = { rule_->offset(t), rule_->is_dst(t) };
+      if (next.offset == current.offset && next.is_dst == current.is_dst)
+        continue;
+      size_t i = 0;
+      while (i < types_.size() && (types_[i].offset != next.offset ||
+        types_[i].is_dst != next.is_dst))
+        ++i;
+      if (i == 256)
+        return;
+      if (i == types_.size())
+        types_.push_back(next);
+      times_.push_back(t);
+      after_.push_back(uint8_t(i));
+      current = next;
+    }
+  }
+
+  // Fills tree_ with times_ in Eytzinger order by an in-order walk, padded
+  // with INT64_MAX to a complete tree, for every search to take as many
+  // steps.
+  size_t fill(size_t i, size_t k) {
+    if (k < tree_.size()) {
+      i = fill(i, 2 * k);
+      if (i < times_.size()) {
+        tree_[k]   = times_[i];
+        before_[k] = i == 0 ? 0 : after_[i - 1];
+        nodes_[i]  = uint32_t(k);
+      }
+      i = fill(i + 1, 2 * k + 1);
+    }
+    return i;
+  }
+
+  void index() {
+    size_t const size = std::bit_ceil(times_.size() + 1);
+    tree_.assign(size, INT64_MAX);
+    before_.assign(size, 0);
+    nodes_.assign(times_.size(), 0);
+    fill(0, 1);
+  }
+
+  // The tree index of the first transition after utc, or 0 or that of a
+  // padding if none.
+  uint32_t search(int64_t utc) const {
+    size_t k = 1;
+    while (k < tree_.size())
+      k = 2 * k + (tree_[k] <= utc);
+    // Undo the right turns after the last left turn, and that turn:
+    return uint32_t(k >> (std::countr_one(k) + 1));
+  }
+
+  type_t type(int64_t utc, uint32_t node) const {
+    if (tree_[node] != INT64_MAX)
+      return types_[before_[node]];
+    if (rule_)
+      return { rule_->offset(utc), rule_->is_dst(utc) };
+    if (times_.empty())
+      return types_[0];
+    return types_[after_.back()];
+  }
+
+  static inline
+  local_time_t local_time(int64_t utc, type_t const& type) {
+    int64_t const local = utc + type.offset;
+    int64_t const days  = local / 86400 - (local % 86400 < 0);
+    hms_t const hms = time_of_day::from_seconds(uint32_t(local -
+      86400 * days));
+    return { benjoffe_fast64::to_date(int32_t(days)), hms.hour, hms.minute,
+      hms.second, type.offset, type.is_dst };
+  }
+
+}; // struct tzif
+
+#endif // EAF_UTIL_TZIF_HPP